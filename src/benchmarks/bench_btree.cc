@@ -0,0 +1,82 @@
+// s21::btree_map against the AVL based s21::map: random inserts, lookups,
+// full and short range scans, bulk loading and bytes per key.
+#include <string>
+
+#include "../s21_btree_map.h"
+#include "../s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+// The tree map spends one node per key; its pool blocks are ignored.
+template <typename Map>
+std::size_t bytesUsed(const Map &, std::size_t n) {
+  return n * sizeof(typename Map::Node);
+}
+
+template <typename K, typename V>
+std::size_t bytesUsed(const s21::btree_map<K, V> &m, std::size_t) {
+  return m.memory_usage();
+}
+
+template <typename Map>
+void run(const char *name, const std::vector<int> &keys) {
+  Map m;
+  std::size_t n = keys.size();
+  double insertNs = s21_bench::elapsedNs([&] {
+    for (int key : keys) m.insert(key, key);
+  });
+  std::size_t found = 0;
+  double findNs = s21_bench::elapsedNs([&] {
+    for (int key : keys) found += m.count(key);
+  });
+  long long sum = 0;
+  double scanNs = s21_bench::elapsedNs([&] {
+    for (auto it = m.begin(), end = m.end(); it != end; ++it) {
+      sum += (*it).second;
+    }
+  });
+  // Short scans of 100 elements starting at random keys.
+  std::size_t ranges = n / 100;
+  double rangeNs = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < ranges; ++i) {
+      auto it = m.lower_bound(keys[i]);
+      auto end = m.end();
+      for (int step = 0; step < 100 && it != end; ++step, ++it) {
+        sum += (*it).second;
+      }
+    }
+  });
+  s21_bench::doNotOptimize(found);
+  s21_bench::doNotOptimize(sum);
+  std::printf("%10zu %-16s %10.1f %10.1f %10.2f %10.1f %10.1f\n", n, name,
+              insertNs / n, findNs / n, scanNs / n,
+              ranges ? rangeNs / ranges : 0.0,
+              static_cast<double>(bytesUsed(m, n)) / n);
+}
+
+void runBulk(std::size_t n) {
+  std::vector<std::pair<int, int>> items(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    items[i] = {static_cast<int>(i), static_cast<int>(i)};
+  }
+  s21::btree_map<int, int> m;
+  double bulkNs = s21_bench::elapsedNs(
+      [&] { m.assign_sorted(items.begin(), items.end()); });
+  std::printf("%10zu %-16s %10.1f %10s %10s %10s %10.1f\n", n,
+              "btree bulk load", bulkNs / n, "-", "-", "-",
+              static_cast<double>(m.memory_usage()) / n);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %-16s %10s %10s %10s %10s %10s\n", "n", "container",
+              "insert ns", "find ns", "scan ns", "range100", "bytes/key");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::vector<int> keys = s21_bench::shuffledKeys(n);
+    run<s21::btree_map<int, int>>("s21::btree_map", keys);
+    run<s21::map<int, int>>("s21::map", keys);
+    runBulk(n);
+  }
+  return 0;
+}
@@ -0,0 +1,82 @@
+// Connections from a pool are relinked in the middle of a list: each step
+// unlinks a random connection and links it again before another random
+// one. s21::intrusive_list keeps the links inside the connection.
+// s21::list<Connection *> stores the list iterator in the connection, which
+// is the best a non-intrusive list can do, but it still pays one node
+// allocation per insert and one extra indirection per element.
+#include <random>
+#include <vector>
+
+#include "../s21_intrusive_list.h"
+#include "../s21_list.h"
+#include "bench_utils.h"
+
+namespace {
+struct Connection {
+  std::size_t id = 0;
+  s21::intrusive_list_hook hook;
+  s21::list<Connection *>::iterator position;
+};
+
+std::vector<std::size_t> picks(std::size_t n, std::size_t ops) {
+  std::mt19937_64 gen(42);
+  std::vector<std::size_t> result(2 * ops);
+  for (std::size_t &pick : result) pick = gen() % n;
+  return result;
+}
+
+double intrusiveNs(std::vector<Connection> &pool,
+                   const std::vector<std::size_t> &order) {
+  s21::intrusive_list<Connection, &Connection::hook> list;
+  for (Connection &c : pool) list.push_back(c);
+  double ns = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < order.size(); i += 2) {
+      Connection &moved = pool[order[i]];
+      Connection &before = pool[order[i + 1]];
+      if (&moved == &before) continue;
+      list.erase(moved);
+      list.insert(list.iterator_to(before), moved);
+    }
+  });
+  std::size_t sum = 0;
+  for (const Connection &c : list) sum += c.id;
+  s21_bench::doNotOptimize(sum);
+  list.clear();
+  return ns;
+}
+
+double pointerListNs(std::vector<Connection> &pool,
+                     const std::vector<std::size_t> &order) {
+  s21::list<Connection *> list;
+  for (Connection &c : pool) c.position = list.insert(list.end(), &c);
+  double ns = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < order.size(); i += 2) {
+      Connection &moved = pool[order[i]];
+      Connection &before = pool[order[i + 1]];
+      if (&moved == &before) continue;
+      list.erase(moved.position);
+      moved.position = list.insert(before.position, &moved);
+    }
+  });
+  std::size_t sum = 0;
+  for (Connection *c : list) sum += c->id;
+  s21_bench::doNotOptimize(sum);
+  return ns;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 1000000);
+  std::size_t ops = 1000000;
+  std::printf("%10s %-26s %10s\n", "n", "list", "ns/op");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::vector<Connection> pool(n);
+    for (std::size_t i = 0; i < n; ++i) pool[i].id = i;
+    std::vector<std::size_t> order = picks(n, ops);
+    std::printf("%10zu %-26s %10.1f\n", n, "s21::intrusive_list",
+                intrusiveNs(pool, order) / ops);
+    std::printf("%10zu %-26s %10.1f\n", n, "s21::list<Connection *>",
+                pointerListNs(pool, order) / ops);
+  }
+  return 0;
+}
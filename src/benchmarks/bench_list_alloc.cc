@@ -0,0 +1,100 @@
+// Queue churn on a list, push_back then pop_front around a steady backlog:
+// heap allocations and time per operation for s21::list with the default
+// allocator, s21::pmr::list over a pool_resource owned by the list's user,
+// and std::list. Also the cost of creating empty lists. Allocations are
+// counted by wrapping the glibc allocator, which operator new and the
+// pool's upstream resource both go through.
+#include <list>
+
+#include "../s21_list.h"
+#include "../s21_memory_resource.h"
+#include "bench_utils.h"
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_realloc(void *p, size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void __libc_free(void *p);
+}
+
+namespace {
+std::size_t allocations = 0;
+}  // namespace
+
+extern "C" {
+void *malloc(size_t size) noexcept {
+  ++allocations;
+  return __libc_malloc(size);
+}
+
+void *realloc(void *p, size_t size) noexcept {
+  ++allocations;
+  return __libc_realloc(p, size);
+}
+
+void *calloc(size_t count, size_t size) noexcept {
+  ++allocations;
+  return __libc_calloc(count, size);
+}
+
+void free(void *p) noexcept { __libc_free(p); }
+}
+
+namespace {
+constexpr std::size_t kBacklog = 64;
+
+template <typename List>
+void churn(const char *name, List &queue, std::size_t n) {
+  for (std::size_t i = 0; i < kBacklog; ++i) queue.push_back(i);
+  std::size_t before = allocations;
+  double ns = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      queue.push_back(i);
+      queue.pop_front();
+    }
+  });
+  s21_bench::doNotOptimize(queue.front());
+  std::printf("%10zu %-26s %-12s %10.3f %10.1f\n", n, name, "churn",
+              static_cast<double>(allocations - before) / n, ns / n);
+}
+
+template <typename List>
+void empties(const char *name, std::size_t n) {
+  std::size_t before = allocations;
+  std::size_t sizes = 0;
+  double ns = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      List list;
+      s21_bench::doNotOptimize(list);
+      sizes += list.size();
+    }
+  });
+  s21_bench::doNotOptimize(sizes);
+  std::printf("%10zu %-26s %-12s %10.3f %10.1f\n", n, name, "empty list",
+              static_cast<double>(allocations - before) / n, ns / n);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %-26s %-12s %10s %10s\n", "n", "list", "workload",
+              "allocs/op", "ns/op");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    {
+      s21::list<std::size_t> queue;
+      churn("s21::list", queue, n);
+    }
+    {
+      s21::pmr::pool_resource pool;
+      s21::pmr::list<std::size_t> queue(&pool);
+      churn("s21::pmr::list + pool", queue, n);
+    }
+    {
+      std::list<std::size_t> queue;
+      churn("std::list", queue, n);
+    }
+    empties<s21::list<std::size_t>>("s21::list", n);
+    empties<std::list<std::size_t>>("std::list", n);
+  }
+  return 0;
+}
@@ -0,0 +1,40 @@
+// Sorting a list of shuffled ints with s21::list::sort and std::list::sort,
+// plus a nearly sorted list where runs already exist.
+#include <list>
+
+#include "../s21_list.h"
+#include "bench_utils.h"
+
+namespace {
+template <typename List>
+double sortNs(const std::vector<int> &keys) {
+  List list;
+  for (int key : keys) list.push_back(key);
+  double ns = s21_bench::elapsedNs([&] { list.sort(); });
+  s21_bench::doNotOptimize(list.front());
+  return ns;
+}
+
+void run(const char *input, const std::vector<int> &keys) {
+  double custom = sortNs<s21::list<int>>(keys);
+  double original = sortNs<std::list<int>>(keys);
+  std::printf("%10zu %-10s %14.1f %14.1f\n", keys.size(), input,
+              custom / 1e6, original / 1e6);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %-10s %14s %14s\n", "n", "input", "s21::list ms",
+              "std::list ms");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::vector<int> keys = s21_bench::shuffledKeys(n);
+    run("shuffled", keys);
+    std::sort(keys.begin(), keys.end());
+    for (std::size_t i = 0; i + 1 < n; i += 100) {
+      std::swap(keys[i], keys[i + 1]);
+    }
+    run("nearly", keys);
+  }
+  return 0;
+}
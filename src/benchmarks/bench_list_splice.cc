@@ -0,0 +1,48 @@
+// Relinking nodes between lists as LRU caches and work queues do, for
+// s21::list and std::list: moving a whole list of up to 10M nodes, a single
+// node to the front, and a 100-node range out to another list and back into
+// place in one piece. None of the splices allocate or copy elements.
+#include <list>
+
+#include "../s21_list.h"
+#include "bench_utils.h"
+
+namespace {
+template <typename List>
+void run(const char *name, std::size_t n) {
+  List from;
+  List to;
+  for (std::size_t i = 0; i < n; ++i) from.push_back(static_cast<int>(i));
+  double whole_ns = s21_bench::elapsedNs([&] { to.splice(to.end(), from); });
+  std::size_t ops = 1000000;
+  double single_ns = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < ops; ++i) {
+      // Move-to-front of the least recently used entry.
+      to.splice(to.begin(), to, --to.end());
+    }
+  });
+  auto first = to.begin();
+  auto last = first;
+  for (int i = 0; i < 100; ++i) ++last;
+  double range_ns = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < ops; ++i) {
+      from.splice(from.end(), to, first, last);
+      to.splice(last, from);
+    }
+  });
+  s21_bench::doNotOptimize(to.front());
+  std::printf("%10zu %-10s %12.1f %12.1f %12.1f\n", n, name, whole_ns / 1000,
+              single_ns / ops, range_ns / ops);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %-10s %12s %12s %12s\n", "n", "list", "whole us",
+              "node ns", "range ns");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    run<s21::list<int>>("s21::list", n);
+    run<std::list<int>>("std::list", n);
+  }
+  return 0;
+}
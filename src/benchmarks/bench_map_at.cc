@@ -0,0 +1,41 @@
+// Regression guard for map::at: every lookup has to descend one root to
+// leaf path. Exits with a failure when the comparisons per lookup on a
+// 1M-entry map exceed the AVL height budget.
+#include "../s21_map.h"
+#include "bench_utils.h"
+
+namespace {
+std::size_t comparisons = 0;
+
+struct CountedKey {
+  int value;
+  friend bool operator<(const CountedKey &a, const CountedKey &b) {
+    ++comparisons;
+    return a.value < b.value;
+  }
+};
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t n = s21_bench::maxSize(argc, argv, 1000000);
+  std::vector<int> keys = s21_bench::shuffledKeys(n);
+  s21::map<CountedKey, int> m;
+  for (int key : keys) m.insert(CountedKey{key}, key);
+
+  comparisons = 0;
+  long long sum = 0;
+  double ns = s21_bench::elapsedNs([&] {
+    for (int key : keys) sum += m.at(CountedKey{key});
+  });
+  s21_bench::doNotOptimize(sum);
+
+  double perLookup = static_cast<double>(comparisons) / n;
+  double budget = 2 * (1.45 * std::log2(static_cast<double>(n)) + 2);
+  std::printf("n = %zu: %.1f ns/op, %.1f comparisons/op (budget %.1f)\n", n,
+              ns / n, perLookup, budget);
+  if (perLookup > budget) {
+    std::printf("FAIL: map::at is not logarithmic\n");
+    return 1;
+  }
+  return 0;
+}
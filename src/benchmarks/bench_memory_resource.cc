@@ -0,0 +1,94 @@
+// Request-scoped workload: every request builds kVectors vectors of a few
+// dozen ints and drops them all at the end. s21::vector on the global heap
+// against s21::pmr::vector on a monotonic arena reset per request (first
+// in a stack buffer, then on the heap), on a pool, and on the standard
+// monotonic_buffer_resource.
+#include <memory_resource>
+#include <vector>
+
+#include "../s21_memory_resource.h"
+#include "../s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+constexpr std::size_t kVectors = 32;
+
+template <typename Vector, typename Make>
+std::size_t handle(std::size_t request, Make &&make) {
+  std::size_t total = 0;
+  std::vector<Vector> vectors;
+  vectors.reserve(kVectors);
+  for (std::size_t i = 0; i < kVectors; ++i) {
+    vectors.push_back(make());
+    std::size_t length = 8 + (request * 7 + i * 13) % 56;
+    for (std::size_t j = 0; j < length; ++j) {
+      vectors.back().push_back(static_cast<int>(j));
+    }
+    total += vectors.back().size();
+  }
+  return total;
+}
+
+void report(const char *name, std::size_t requests, double ns,
+            std::size_t total) {
+  s21_bench::doNotOptimize(total);
+  std::printf("%10zu %-28s %10.1f\n", requests, name, ns / requests);
+}
+
+void run(std::size_t requests) {
+  std::size_t total = 0;
+  double ns = s21_bench::elapsedNs([&] {
+    for (std::size_t r = 0; r < requests; ++r) {
+      total += handle<s21::vector<int>>(r, [] { return s21::vector<int>(); });
+    }
+  });
+  report("global heap", requests, ns, total);
+
+  alignas(std::max_align_t) static char buffer[64 << 10];
+  ns = s21_bench::elapsedNs([&] {
+    s21::pmr::monotonic_resource arena(buffer, sizeof(buffer));
+    for (std::size_t r = 0; r < requests; ++r) {
+      total += handle<s21::pmr::vector<int>>(
+          r, [&] { return s21::pmr::vector<int>(&arena); });
+      arena.release();
+    }
+  });
+  report("monotonic, stack buffer", requests, ns, total);
+
+  ns = s21_bench::elapsedNs([&] {
+    s21::pmr::monotonic_resource arena(16 << 10);
+    for (std::size_t r = 0; r < requests; ++r) {
+      total += handle<s21::pmr::vector<int>>(
+          r, [&] { return s21::pmr::vector<int>(&arena); });
+      arena.release();
+    }
+  });
+  report("monotonic, heap chunks", requests, ns, total);
+
+  ns = s21_bench::elapsedNs([&] {
+    s21::pmr::pool_resource pool;
+    for (std::size_t r = 0; r < requests; ++r) {
+      total += handle<s21::pmr::vector<int>>(
+          r, [&] { return s21::pmr::vector<int>(&pool); });
+    }
+  });
+  report("pool", requests, ns, total);
+
+  ns = s21_bench::elapsedNs([&] {
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+    for (std::size_t r = 0; r < requests; ++r) {
+      total += handle<s21::pmr::vector<int>>(
+          r, [&] { return s21::pmr::vector<int>(&arena); });
+      arena.release();
+    }
+  });
+  report("std monotonic_buffer", requests, ns, total);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 100000);
+  std::printf("%10s %-28s %10s\n", "requests", "allocation", "ns/request");
+  for (std::size_t n : s21_bench::sizes(limit)) run(n);
+  return 0;
+}
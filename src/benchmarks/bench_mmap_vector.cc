@@ -0,0 +1,84 @@
+// Cold start of a persisted array of records: opening an s21::mmap_vector
+// read-only against reading the same bytes into an s21::vector, as a
+// deserializer would. Shown are the time to have the data addressable and
+// the time to first scan all of it. The file stays in the page cache, so
+// this measures the copy and allocation avoided, not disk speed.
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "../s21_mmap_vector.h"
+#include "../s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+struct Record {
+  int64_t id;
+  double x;
+  double y;
+  int32_t flags;
+  int32_t group;
+};
+
+double scan(const Record *records, std::size_t n) {
+  double sum = 0;
+  for (std::size_t i = 0; i < n; ++i) sum += records[i].x + records[i].group;
+  return sum;
+}
+
+// Reads the size and elements that mmap_vector wrote after its header.
+s21::vector<Record> deserialize(const std::string &path) {
+  s21::vector<Record> records;
+  std::FILE *f = std::fopen(path.c_str(), "rb");
+  if (f == nullptr) return records;
+  uint64_t header[8];
+  if (std::fread(header, sizeof(header), 1, f) == 1) {
+    records.resize(header[2]);
+    std::size_t read =
+        std::fread(records.data(), sizeof(Record), records.size(), f);
+    records.resize(read);
+  }
+  std::fclose(f);
+  return records;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::string path = "/tmp/s21_bench_mmap_vector.bin";
+  std::printf("%10s %-22s %12s %12s\n", "n", "load", "open us", "scan us");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::remove(path.c_str());
+    {
+      s21::mmap_vector<Record> out(path);
+      out.reserve(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        int64_t id = static_cast<int64_t>(i);
+        out.push_back({id, i * 0.5, i * 0.25, 0, static_cast<int32_t>(i % 7)});
+      }
+    }
+    double sum = 0;
+    double open_ns = 0;
+    double scan_ns = 0;
+    {
+      s21::mmap_vector<Record> *in = nullptr;
+      open_ns = s21_bench::elapsedNs([&] {
+        in = new s21::mmap_vector<Record>(path, s21::mmap_mode::read_only);
+      });
+      scan_ns = s21_bench::elapsedNs([&] { sum += scan(in->data(), n); });
+      delete in;
+    }
+    std::printf("%10zu %-22s %12.1f %12.1f\n", n, "mmap_vector read-only",
+                open_ns / 1000, scan_ns / 1000);
+    {
+      s21::vector<Record> in;
+      open_ns = s21_bench::elapsedNs([&] { in = deserialize(path); });
+      scan_ns = s21_bench::elapsedNs([&] { sum += scan(in.data(), n); });
+    }
+    std::printf("%10zu %-22s %12.1f %12.1f\n", n, "fread into s21::vector",
+                open_ns / 1000, scan_ns / 1000);
+    s21_bench::doNotOptimize(sum);
+  }
+  std::remove(path.c_str());
+  return 0;
+}
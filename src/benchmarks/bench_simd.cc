@@ -0,0 +1,136 @@
+// Throughput of the s21_simd.h kernels behind s21::vector and s21::array
+// against plain element-by-element loops, in GB/s of input read, for
+// int32_t, float and uint8_t buffers. The buffers stay the same size for
+// every n, so small n measure cache-resident data and large n memory.
+#include <cstdint>
+#include <vector>
+
+#include "../s21_simd.h"
+#include "bench_utils.h"
+
+namespace {
+template <typename T>
+struct Scalar {
+  static void fill(T *p, std::size_t n, T v) {
+    for (std::size_t i = 0; i < n; ++i) p[i] = v;
+  }
+  static void swap_ranges(T *a, T *b, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+      T tmp = a[i];
+      a[i] = b[i];
+      b[i] = tmp;
+    }
+  }
+  static bool equal(const T *a, const T *b, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (!(a[i] == b[i])) return false;
+    }
+    return true;
+  }
+  static std::size_t find(const T *p, std::size_t n, T v) {
+    for (std::size_t i = 0; i < n; ++i) {
+      if (p[i] == v) return i;
+    }
+    return n;
+  }
+  static T min(const T *p, std::size_t n) {
+    T result = p[0];
+    for (std::size_t i = 1; i < n; ++i) result = p[i] < result ? p[i] : result;
+    return result;
+  }
+  static typename s21::simd_sum<T>::type sum(const T *p, std::size_t n) {
+    typename s21::simd_sum<T>::type result = 0;
+    for (std::size_t i = 0; i < n; ++i) result += p[i];
+    return result;
+  }
+};
+
+template <typename T>
+struct Simd {
+  static void fill(T *p, std::size_t n, T v) { s21::simd::fill(p, n, v); }
+  static void swap_ranges(T *a, T *b, std::size_t n) {
+    s21::simd::swap_ranges(a, b, n);
+  }
+  static bool equal(const T *a, const T *b, std::size_t n) {
+    return s21::simd::equal(a, b, n);
+  }
+  static std::size_t find(const T *p, std::size_t n, T v) {
+    return s21::simd::find(p, n, v);
+  }
+  static T min(const T *p, std::size_t n) { return s21::simd::min(p, n); }
+  static typename s21::simd_sum<T>::type sum(const T *p, std::size_t n) {
+    return s21::simd::sum(p, n);
+  }
+};
+
+// Repeats body until about 2^28 bytes went through and returns GB/s.
+template <typename F>
+double throughput(std::size_t bytes, F &&body) {
+  std::size_t rounds = std::max<std::size_t>(1, (std::size_t(1) << 28) / bytes);
+  double ns = s21_bench::elapsedNs([&] {
+    for (std::size_t r = 0; r < rounds; ++r) body();
+  });
+  return static_cast<double>(bytes) * rounds / ns;
+}
+
+template <typename T, typename K>
+void run(const char *type, const char *kernels, std::size_t n) {
+  std::vector<T> a(n, T(3)), b(n, T(3));
+  std::size_t bytes = n * sizeof(T);
+  double fill = throughput(bytes, [&] { K::fill(a.data(), n, T(3)); });
+  double swap = throughput(2 * bytes, [&] {
+    K::swap_ranges(a.data(), b.data(), n);
+  });
+  bool same = true;
+  double equal = throughput(2 * bytes, [&] {
+    same &= K::equal(a.data(), b.data(), n);
+    s21_bench::doNotOptimize(a.data());
+  });
+  std::size_t found = 0;
+  double find = throughput(bytes, [&] {
+    found += K::find(a.data(), n, T(5));
+    s21_bench::doNotOptimize(a.data());
+  });
+  T low = T();
+  double min = throughput(bytes, [&] {
+    low = K::min(a.data(), n);
+    s21_bench::doNotOptimize(low);
+    s21_bench::doNotOptimize(a.data());
+  });
+  typename s21::simd_sum<T>::type total = 0;
+  double sum = throughput(bytes, [&] {
+    total += K::sum(a.data(), n);
+    s21_bench::doNotOptimize(a.data());
+  });
+  s21_bench::doNotOptimize(same);
+  s21_bench::doNotOptimize(found);
+  s21_bench::doNotOptimize(total);
+  std::printf("%10zu %-8s %-7s %7.1f %7.1f %7.1f %7.1f %7.1f %7.1f\n", n, type,
+              kernels, fill, swap, equal, find, min, sum);
+}
+
+template <typename T>
+void runBoth(const char *type, std::size_t n) {
+  run<T, Scalar<T>>(type, "scalar", n);
+  run<T, Simd<T>>(type, "simd", n);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%s dispatch, GB/s\n",
+#ifdef S21_SIMD_X86
+              s21::simd_detail::hasAvx2() ? "AVX2" : "SSE2"
+#else
+              "scalar"
+#endif
+  );
+  std::printf("%10s %-8s %-7s %7s %7s %7s %7s %7s %7s\n", "n", "type",
+              "kernels", "fill", "swap", "equal", "find", "min", "sum");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    runBoth<int32_t>("int32", n);
+    runBoth<float>("float", n);
+    runBoth<uint8_t>("uint8", n);
+  }
+  return 0;
+}
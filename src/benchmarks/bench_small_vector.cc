@@ -0,0 +1,74 @@
+// Building many short vectors of ints, as in adjacency lists or per-request
+// headers: heap allocations and time per vector for s21::small_vector with
+// 8 inline slots, s21::vector and std::vector. Allocations are counted by
+// wrapping the glibc allocator, which both malloc and operator new go
+// through.
+#include <vector>
+
+#include "../s21_small_vector.h"
+#include "../s21_vector.h"
+#include "bench_utils.h"
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_realloc(void *p, size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void __libc_free(void *p);
+}
+
+namespace {
+std::size_t allocations = 0;
+}  // namespace
+
+extern "C" {
+void *malloc(size_t size) noexcept {
+  ++allocations;
+  return __libc_malloc(size);
+}
+
+void *realloc(void *p, size_t size) noexcept {
+  ++allocations;
+  return __libc_realloc(p, size);
+}
+
+void *calloc(size_t count, size_t size) noexcept {
+  ++allocations;
+  return __libc_calloc(count, size);
+}
+
+void free(void *p) noexcept { __libc_free(p); }
+}
+
+namespace {
+template <typename Vector>
+void run(const char *name, std::size_t n, std::size_t length) {
+  std::size_t before = allocations;
+  std::size_t sum = 0;
+  double ns = s21_bench::elapsedNs([&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      Vector v;
+      for (std::size_t j = 0; j < length; ++j) {
+        v.push_back(static_cast<int>(i + j));
+      }
+      sum += v[length - 1];
+    }
+  });
+  s21_bench::doNotOptimize(sum);
+  std::printf("%10zu %6zu %-24s %12.2f %10.1f\n", n, length, name,
+              static_cast<double>(allocations - before) / n, ns / n);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 1000000);
+  std::printf("%10s %6s %-24s %12s %10s\n", "n", "length", "container",
+              "allocs/vec", "ns/vec");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    for (std::size_t length : {1, 4, 8, 16}) {
+      run<s21::small_vector<int, 8>>("s21::small_vector<int,8>", n, length);
+      run<s21::vector<int>>("s21::vector<int>", n, length);
+      run<std::vector<int>>("std::vector<int>", n, length);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,24 @@
+// Insert/erase cost of the AVL tree behind s21::set. With O(1) rebalancing
+// per level the ns/op divided by log2(n) should stay roughly constant.
+#include "../s21_set.h"
+#include "bench_utils.h"
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %14s %14s %14s %14s\n", "n", "insert ns/op",
+              "per log2(n)", "erase ns/op", "per log2(n)");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::vector<int> keys = s21_bench::shuffledKeys(n);
+    s21::set<int> s;
+    double insertNs = s21_bench::elapsedNs([&] {
+      for (int key : keys) s.insert(key);
+    });
+    double eraseNs = s21_bench::elapsedNs([&] {
+      for (int key : keys) s.erase(s.find(key));
+    });
+    double log2n = std::log2(static_cast<double>(n));
+    std::printf("%10zu %14.1f %14.2f %14.1f %14.2f\n", n, insertNs / n,
+                insertNs / n / log2n, eraseNs / n, eraseNs / n / log2n);
+  }
+  return 0;
+}
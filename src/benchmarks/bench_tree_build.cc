@@ -0,0 +1,32 @@
+// Building s21::map from a sorted snapshot: one insert per item against the
+// linear assign_sorted, and assign_sorted on shuffled input.
+#include "../s21_map.h"
+#include "bench_utils.h"
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %14s %14s %14s\n", "n", "insert ns", "sorted ns",
+              "shuffled ns");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::vector<std::pair<int, int>> items(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      items[i] = {static_cast<int>(i), static_cast<int>(i)};
+    }
+    s21::map<int, int> m1;
+    double insertNs = s21_bench::elapsedNs([&] {
+      for (const auto &item : items) m1.insert(item);
+    });
+    s21::map<int, int> m2;
+    double sortedNs = s21_bench::elapsedNs(
+        [&] { m2.assign_sorted(items.begin(), items.end()); });
+    std::vector<int> keys = s21_bench::shuffledKeys(n);
+    for (std::size_t i = 0; i < n; ++i) items[i] = {keys[i], keys[i]};
+    s21::map<int, int> m3;
+    double shuffledNs = s21_bench::elapsedNs(
+        [&] { m3.assign_sorted(items.begin(), items.end()); });
+    s21_bench::doNotOptimize(m1.size() + m2.size() + m3.size());
+    std::printf("%10zu %14.1f %14.1f %14.1f\n", n, insertNs / n, sortedNs / n,
+                shuffledNs / n);
+  }
+  return 0;
+}
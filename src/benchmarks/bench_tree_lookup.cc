@@ -0,0 +1,46 @@
+// Point lookup latency of the iterative BinaryTree search path compared
+// with the standard red-black tree containers.
+#include <map>
+#include <set>
+
+#include "../s21_set.h"
+#include "bench_utils.h"
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  const std::size_t probes = 1000000;
+  std::printf("%10s %14s %14s %14s\n", "n", "s21::set ns", "std::set ns",
+              "std::map ns");
+  for (std::size_t n : {std::size_t(1000), std::size_t(1000000),
+                        std::size_t(10000000)}) {
+    if (n > limit) break;
+    std::vector<int> keys = s21_bench::shuffledKeys(n);
+    std::vector<int> queries(probes);
+    for (std::size_t i = 0; i < probes; ++i) queries[i] = keys[i % n];
+    std::shuffle(queries.begin(), queries.end(), std::mt19937(7));
+
+    s21::set<int> s21set;
+    std::set<int> stdset;
+    std::map<int, int> stdmap;
+    for (int key : keys) {
+      s21set.insert(key);
+      stdset.insert(key);
+      stdmap.emplace(key, key);
+    }
+
+    std::size_t found = 0;
+    double s21Ns = s21_bench::elapsedNs([&] {
+      for (int key : queries) found += s21set.contains(key);
+    });
+    double setNs = s21_bench::elapsedNs([&] {
+      for (int key : queries) found += stdset.count(key);
+    });
+    double mapNs = s21_bench::elapsedNs([&] {
+      for (int key : queries) found += stdmap.find(key) != stdmap.end();
+    });
+    s21_bench::doNotOptimize(found);
+    std::printf("%10zu %14.1f %14.1f %14.1f\n", n, s21Ns / probes,
+                setNs / probes, mapNs / probes);
+  }
+  return 0;
+}
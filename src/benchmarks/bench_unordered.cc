@@ -0,0 +1,63 @@
+// Point operations of the SwissTable based s21::unordered_map against the
+// AVL based s21::map and std::unordered_map, for dense int keys and for
+// 64-bit keys that differ only in their high bits.
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "../s21_map.h"
+#include "../s21_unordered_map.h"
+#include "bench_utils.h"
+
+namespace {
+template <typename Map, typename Key>
+void run(const char *name, const std::vector<Key> &keys,
+         const std::vector<Key> &misses) {
+  Map m;
+  std::size_t n = keys.size();
+  double insertNs = s21_bench::elapsedNs([&] {
+    for (Key key : keys) m.insert({key, key});
+  });
+  std::size_t found = 0;
+  double hitNs = s21_bench::elapsedNs([&] {
+    for (Key key : keys) found += m.count(key);
+  });
+  double missNs = s21_bench::elapsedNs([&] {
+    for (Key key : misses) found += m.count(key);
+  });
+  double eraseNs = s21_bench::elapsedNs([&] {
+    for (Key key : keys) m.erase(m.find(key));
+  });
+  s21_bench::doNotOptimize(found);
+  std::printf("%10zu %-22s %10.1f %10.1f %10.1f %10.1f\n", n, name,
+              insertNs / n, hitNs / n, missNs / n, eraseNs / n);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %-22s %10s %10s %10s %10s\n", "n", "container",
+              "insert", "hit", "miss", "erase");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::vector<int> keys = s21_bench::shuffledKeys(n);
+    std::vector<int> misses(keys);
+    for (int &key : misses) key += static_cast<int>(n);
+    run<s21::unordered_map<int, int>>("s21::unordered_map", keys, misses);
+    run<s21::map<int, int>>("s21::map", keys, misses);
+    run<std::unordered_map<int, int>>("std::unordered_map", keys, misses);
+  }
+  std::printf("keys shifted into the high 32 bits\n");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::vector<std::uint64_t> keys;
+    for (int key : s21_bench::shuffledKeys(n)) {
+      keys.push_back(static_cast<std::uint64_t>(key) << 32);
+    }
+    std::vector<std::uint64_t> misses(keys);
+    for (std::uint64_t &key : misses) key += std::uint64_t(n) << 32;
+    run<s21::unordered_map<std::uint64_t, std::uint64_t>>(
+        "s21::unordered_map", keys, misses);
+    run<std::unordered_map<std::uint64_t, std::uint64_t>>(
+        "std::unordered_map", keys, misses);
+  }
+  return 0;
+}
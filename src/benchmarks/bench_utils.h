@@ -0,0 +1,51 @@
+#ifndef SRC_BENCHMARKS_BENCH_UTILS_H_
+#define SRC_BENCHMARKS_BENCH_UTILS_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace s21_bench {
+// Largest problem size for a benchmark, overridable with the first argument
+// so that the suites can be smoke-tested quickly.
+inline std::size_t maxSize(int argc, char **argv, std::size_t fallback) {
+  if (argc > 1) return std::strtoull(argv[1], nullptr, 10);
+  return fallback;
+}
+
+// Powers of ten from 10^3 up to limit.
+inline std::vector<std::size_t> sizes(std::size_t limit) {
+  std::vector<std::size_t> result;
+  for (std::size_t n = 1000; n <= limit; n *= 10) result.push_back(n);
+  if (result.empty()) result.push_back(limit);
+  return result;
+}
+
+inline std::vector<int> shuffledKeys(std::size_t n, unsigned seed = 42) {
+  std::vector<int> keys(n);
+  std::iota(keys.begin(), keys.end(), 0);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+  return keys;
+}
+
+template <typename F>
+double elapsedNs(F &&body) {
+  auto start = std::chrono::steady_clock::now();
+  body();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+// Keeps the optimizer from dropping a computed value.
+template <typename T>
+inline void doNotOptimize(T const &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+}  // namespace s21_bench
+
+#endif  // SRC_BENCHMARKS_BENCH_UTILS_H_
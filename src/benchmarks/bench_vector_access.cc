@@ -0,0 +1,56 @@
+// Indexed loops over s21::vector<float>: unchecked operator[] lets the
+// compiler vectorise y[i] = a * x[i] + y[i], the bounds check of at() does
+// not. std::vector is the reference.
+#include <vector>
+
+#include "../s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+constexpr int kRounds = 20;
+
+template <typename Vector, typename Access>
+double saxpy(std::size_t n, Access access) {
+  Vector x(n, 1.5f);
+  Vector y(n, 0.5f);
+  float a = 1.0001f;
+  double ns = s21_bench::elapsedNs([&] {
+    for (int round = 0; round < kRounds; ++round) {
+      for (std::size_t i = 0; i < n; ++i) {
+        access(y, i) = a * access(x, i) + access(y, i);
+      }
+      s21_bench::doNotOptimize(y[n / 2]);
+    }
+  });
+  return ns / (static_cast<double>(n) * kRounds);
+}
+
+struct Index {
+  template <typename Vector>
+  float &operator()(Vector &v, std::size_t i) const {
+    return v[i];
+  }
+};
+
+struct Checked {
+  template <typename Vector>
+  float &operator()(Vector &v, std::size_t i) const {
+    return v.at(i);
+  }
+};
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 10000000);
+  std::printf("%10s %16s %16s %16s\n", "n", "s21 [] ns/elem",
+              "s21 at() ns/elem", "std [] ns/elem");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    using s21_vec = s21::vector<float>;
+    using std_vec = std::vector<float>;
+    std::printf("%10zu %16.3f %16.3f %16.3f\n", n,
+                saxpy<s21_vec>(n, Index()),
+                saxpy<s21_vec>(n, Checked()),
+                saxpy<std_vec>(n, Index()));
+  }
+  return 0;
+}
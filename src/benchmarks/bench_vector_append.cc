@@ -0,0 +1,33 @@
+// Appending ints one at a time to s21::vector and std::vector, from empty
+// and after reserve, for up to 10^8 elements.
+#include <vector>
+
+#include "../s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+template <typename Vector>
+double append(std::size_t n, bool reserve) {
+  Vector v;
+  double ns = s21_bench::elapsedNs([&] {
+    if (reserve) v.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+  });
+  s21_bench::doNotOptimize(v.data()[n / 2]);
+  return ns / n;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 100000000);
+  std::printf("%10s %14s %14s %14s %14s\n", "n", "s21 ns", "std ns",
+              "s21 reserved", "std reserved");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    std::printf("%10zu %14.2f %14.2f %14.2f %14.2f\n", n,
+                append<s21::vector<int>>(n, false),
+                append<std::vector<int>>(n, false),
+                append<s21::vector<int>>(n, true),
+                append<std::vector<int>>(n, true));
+  }
+  return 0;
+}
@@ -0,0 +1,62 @@
+// Inserting a batch of 1000 ints into the middle of a vector of n ints: one
+// element at a time, as one range with s21::vector and std::vector, and the
+// matching range erase.
+#include <numeric>
+#include <vector>
+
+#include "../s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+constexpr std::size_t kBatch = 1000;
+
+template <typename Vector>
+Vector filled(std::size_t n) {
+  Vector v;
+  v.reserve(n + kBatch);
+  for (std::size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+  return v;
+}
+
+template <typename Vector>
+double oneByOne(std::size_t n, const std::vector<int> &batch) {
+  Vector v = filled<Vector>(n);
+  double ns = s21_bench::elapsedNs([&] {
+    std::size_t index = n / 2;
+    for (int value : batch) v.insert(v.begin() + index++, value);
+  });
+  s21_bench::doNotOptimize(v.data()[n / 2]);
+  return ns / 1000.0;
+}
+
+template <typename Vector>
+double bulk(std::size_t n, const std::vector<int> &batch, double *eraseUs) {
+  Vector v = filled<Vector>(n);
+  double ns = s21_bench::elapsedNs(
+      [&] { v.insert(v.begin() + n / 2, batch.begin(), batch.end()); });
+  s21_bench::doNotOptimize(v.data()[n / 2]);
+  *eraseUs = s21_bench::elapsedNs([&] {
+               v.erase(v.begin() + n / 2, v.begin() + n / 2 + kBatch);
+             }) /
+             1000.0;
+  s21_bench::doNotOptimize(v.data()[n / 2]);
+  return ns / 1000.0;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 1000000);
+  std::vector<int> batch(kBatch);
+  std::iota(batch.begin(), batch.end(), -static_cast<int>(kBatch));
+  std::printf("%10s %14s %14s %14s %14s %14s\n", "n", "s21 1-by-1 us",
+              "s21 range us", "std range us", "s21 erase us", "std erase us");
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    double s21Erase = 0, stdErase = 0;
+    double single = oneByOne<s21::vector<int>>(n, batch);
+    double s21Bulk = bulk<s21::vector<int>>(n, batch, &s21Erase);
+    double stdBulk = bulk<std::vector<int>>(n, batch, &stdErase);
+    std::printf("%10zu %14.1f %14.1f %14.1f %14.1f %14.1f\n", n, single,
+                s21Bulk, stdBulk, s21Erase, stdErase);
+  }
+  return 0;
+}
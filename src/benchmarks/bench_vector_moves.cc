@@ -0,0 +1,100 @@
+// Copies and moves of elements per operation for s21::vector and
+// std::vector of heap-owning strings, with a noexcept move constructor and
+// with a move constructor that may throw (relocation has to copy then).
+#include <string>
+#include <vector>
+
+#include "../s21_vector.h"
+#include "bench_utils.h"
+
+namespace {
+struct Counters {
+  static inline std::size_t copies = 0;
+  static inline std::size_t moves = 0;
+};
+
+template <bool NoexceptMove>
+struct Counted {
+  Counted() = default;
+  explicit Counted(std::size_t i)
+      : text("a string long enough to live on the heap #" +
+             std::to_string(i)) {}
+  Counted(const Counted &other) : text(other.text) { ++Counters::copies; }
+  Counted(Counted &&other) noexcept(NoexceptMove)
+      : text(std::move(other.text)) {
+    ++Counters::moves;
+  }
+  Counted &operator=(const Counted &other) {
+    text = other.text;
+    ++Counters::copies;
+    return *this;
+  }
+  Counted &operator=(Counted &&other) noexcept(NoexceptMove) {
+    text = std::move(other.text);
+    ++Counters::moves;
+    return *this;
+  }
+
+  std::string text;
+};
+
+template <typename F>
+void report(const char *container, const char *op, std::size_t ops,
+            F &&body) {
+  Counters::copies = 0;
+  Counters::moves = 0;
+  double ns = s21_bench::elapsedNs(body);
+  std::printf("%-14s %-24s %10.2f %10.2f %10.1f\n", container, op,
+              static_cast<double>(Counters::copies) / ops,
+              static_cast<double>(Counters::moves) / ops, ns / ops);
+}
+
+template <typename Vector>
+void run(const char *container, std::size_t n) {
+  using T = typename Vector::value_type;
+  std::vector<T> source;
+  for (std::size_t i = 0; i < n; ++i) source.emplace_back(i);
+
+  Vector v;
+  report(container, "push_back(const T&)", n, [&] {
+    for (const T &item : source) v.push_back(item);
+  });
+  Vector w;
+  report(container, "push_back(T&&)", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) w.push_back(T(i));
+  });
+  Vector e;
+  report(container, "emplace_back", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) e.emplace_back(i);
+  });
+  std::size_t front = n / 100 ? n / 100 : 1;
+  report(container, "insert(begin, T&&)", front, [&] {
+    for (std::size_t i = 0; i < front; ++i) e.insert(e.begin(), T(i));
+  });
+  report(container, "erase(begin)", front, [&] {
+    for (std::size_t i = 0; i < front; ++i) e.erase(e.begin());
+  });
+  report(container, "reserve(2n)", n, [&] { v.reserve(2 * n); });
+  report(container, "shrink_to_fit", n, [&] { v.shrink_to_fit(); });
+}
+
+template <bool NoexceptMove>
+void runAll(std::size_t n) {
+  using T = Counted<NoexceptMove>;
+  std::printf("\nn = %zu, move constructor %s\n", n,
+              NoexceptMove ? "noexcept" : "may throw");
+  std::printf("%-14s %-24s %10s %10s %10s\n", "container", "operation",
+              "copies/op", "moves/op", "ns/op");
+  run<s21::vector<T>>("s21::vector", n);
+  run<std::vector<T>>("std::vector", n);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::size_t limit = s21_bench::maxSize(argc, argv, 1000000);
+  for (std::size_t n : s21_bench::sizes(limit)) {
+    runAll<true>(n);
+    runAll<false>(n);
+  }
+  return 0;
+}
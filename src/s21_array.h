@@ -3,6 +3,9 @@
 
 #include <iostream>
 
+#include "s21_simd.h"
+#include "s21_span.h"
+
 namespace s21 {
 template <typename T, size_t N>
 class array {
@@ -61,6 +64,7 @@ class array {
   const_reference front() noexcept { return stat_array[0]; }
   const_reference back() noexcept { return stat_array[N - 1]; }
   iterator data() noexcept { return &stat_array[0]; }
+  const_iterator data() const noexcept { return &stat_array[0]; }
 
   iterator begin() noexcept { return &stat_array[0]; }
   iterator end() noexcept { return &stat_array[N]; }
@@ -70,28 +74,68 @@ class array {
   size_type max_size() noexcept { return N; }
 
   void swap(array& other) noexcept {
-    if (size() == other.size()) {
-      value_type temp;
-      for (size_type i = 0; i < N; i++) {
-        temp = stat_array[i];
-        stat_array[i] = other.stat_array[i];
-        other.stat_array[i] = temp;
-      }
-    }
+    simd::swap_ranges(stat_array, other.stat_array, N);
   }
 
   void fill(const_reference value) noexcept {
-    for (size_type i = 0; i < N; i++) {
-      stat_array[i] = value;
-    }
+    simd::fill(stat_array, N, value);
+  }
+
+  iterator find(const_reference value) noexcept {
+    return stat_array + simd::find(stat_array, N, value);
+  }
+
+  bool contains(const_reference value) const noexcept {
+    return simd::find(stat_array, N, value) != N;
+  }
+
+  value_type min() const {
+    if (N == 0) throw std::out_of_range("min of an empty array");
+    return simd::min(stat_array, N);
+  }
+
+  value_type max() const {
+    if (N == 0) throw std::out_of_range("max of an empty array");
+    return simd::max(stat_array, N);
+  }
+
+  typename simd_sum<value_type>::type sum() const noexcept {
+    return simd::sum(stat_array, N);
+  }
+
+  // Views of the elements, with static or dynamic extent.
+  template <typename U, size_t E,
+            typename = std::enable_if_t<
+                (E == N || E == dynamic_extent) &&
+                std::is_convertible<T (*)[], U (*)[]>::value>>
+  operator span<U, E>() noexcept {
+    return span<U, E>(stat_array, N);
+  }
+
+  template <typename U, size_t E,
+            typename = std::enable_if_t<
+                (E == N || E == dynamic_extent) &&
+                std::is_convertible<const T (*)[], U (*)[]>::value>>
+  operator span<U, E>() const noexcept {
+    return span<U, E>(stat_array, N);
   }
 
+  friend bool operator==(const array& a, const array& b) {
+    return simd::equal(a.stat_array, b.stat_array, N);
+  }
+
+  friend bool operator!=(const array& a, const array& b) { return !(a == b); }
+
  private:
   value_type stat_array[N + 1];
 
   void fill_by_zero() noexcept {
-    for (size_type i = 0; i < N; i++) {
-      stat_array[i] = 0;
+    if constexpr (simd::kVectorized<value_type>) {
+      simd::fill(stat_array, N, value_type(0));
+    } else {
+      for (size_type i = 0; i < N; i++) {
+        stat_array[i] = 0;
+      }
     }
   }
 };
@@ -1,14 +1,24 @@
 #ifndef S21_CONTAINERS_BINARY_TREE_H
 #define S21_CONTAINERS_BINARY_TREE_H
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "s21_node_pool.h"
+#include "s21_utility.h"
+
 namespace s21 {
-template <typename key_, typename value_, typename compare_>
-class BinaryTree {
+template <typename key_, typename value_, typename compare_,
+          typename Allocator = std::allocator<value_>>
+class BinaryTree : private EboStorage<compare_> {
  public:
   class Node;
   struct treeIterator;
@@ -23,47 +33,97 @@ class BinaryTree {
   using size_type = std::size_t;
   using iterator = treeIterator;
   using const_iterator = treeIteratorConst;
+  using allocator_type = Allocator;
+
+  BinaryTree() : root(nullptr), size_(0){};
+
+  explicit BinaryTree(const Allocator &alloc)
+      : root(nullptr), size_(0), pool_(alloc){};
 
-  BinaryTree() : root(new Node), size_(0){};
+  explicit BinaryTree(const compare_ &comp,
+                      const Allocator &alloc = Allocator())
+      : EboStorage<compare_>(comp), root(nullptr), size_(0), pool_(alloc){};
 
-  BinaryTree(const BinaryTree &other) : root(nullptr), size_(other.size_) {
-    root = root->copyNode(other.root);
+  BinaryTree(const BinaryTree &other)
+      : EboStorage<compare_>(other.value_comp()),
+        root(nullptr),
+        size_(other.size_),
+        pool_(std::allocator_traits<Allocator>::
+                  select_on_container_copy_construction(
+                      other.pool_.get_allocator())) {
+    root = copyNode(other.root, nullptr);
   }
 
   BinaryTree(BinaryTree &&other) noexcept
-      : root(other.root), size_(other.size_) {
+      : EboStorage<compare_>(std::move(other.value_comp())),
+        root(other.root),
+        size_(other.size_),
+        pool_(std::move(other.pool_)) {
     other.size_ = 0;
-    other.root = new Node();
+    other.root = nullptr;
   }
 
+  // Builds the copy in a separate tree, under the allocator of other when
+  // it propagates on copy assignment, and swaps it in, so a throwing copy
+  // leaves this tree untouched.
   BinaryTree &operator=(const BinaryTree &other) {
     if (this != &other) {
-      size_ = other.size_;
-      root->copyNode(other.root);
+      using traits = std::allocator_traits<Allocator>;
+      BinaryTree copy(other.value_comp(),
+                      traits::propagate_on_container_copy_assignment::value
+                          ? other.pool_.get_allocator()
+                          : pool_.get_allocator());
+      copy.root = copy.copyNode(other.root, nullptr);
+      copy.size_ = other.size_;
+      using std::swap;
+      swap(value_comp(), copy.value_comp());
+      swap(root, copy.root);
+      swap(size_, copy.size_);
+      pool_.exchange(copy.pool_);
     }
     return *this;
-  };
+  }
 
-  BinaryTree &operator=(BinaryTree &&other) noexcept {
+  // Takes the nodes of other when its allocator can be adopted, moves the
+  // values one by one into nodes of this tree otherwise.
+  BinaryTree &operator=(BinaryTree &&other) noexcept(
+      std::allocator_traits<
+          Allocator>::propagate_on_container_move_assignment::value ||
+      std::allocator_traits<Allocator>::is_always_equal::value) {
     if (this != &other) {
       deleteTree();
-      size_ = other.size_;
-      root = other.root;
-
-      other.size_ = 0;
-      other.root = new Node();
+      value_comp() = std::move(other.value_comp());
+      if (pool_.canAdopt(other.pool_)) {
+        size_ = other.size_;
+        root = other.root;
+        pool_ = std::move(other.pool_);
+
+        other.size_ = 0;
+        other.root = nullptr;
+      } else {
+        root = copyNode<true>(other.root, nullptr);
+        size_ = other.size_;
+        other.clearTree();
+      }
     }
     return *this;
   }
 
   ~BinaryTree() { deleteTree(); }
 
-  void deleteTree() {
-    if (root) {
-      size_ = 0;
-      root->clearNode(root);
-      root = nullptr;
-    }
+  void deleteTree() { clearTree(); }
+
+  allocator_type get_allocator() const { return pool_.get_allocator(); }
+
+  compare_ &value_comp() noexcept { return EboStorage<compare_>::get(); }
+  const compare_ &value_comp() const noexcept {
+    return EboStorage<compare_>::get();
+  }
+
+  // Every ordering decision of the tree goes through compare_.
+  template <typename A, typename B>
+  bool compare_Keys(const A &a, const B &b) const {
+    return value_comp()(a, b);
   }
 
   bool empty() const noexcept { return size_ == 0 ? true : false; }
@@ -76,67 +136,114 @@ class BinaryTree {
   }
 
   std::pair<iterator, bool> insertUnique(value_type item) {
-    std::pair<iterator, bool> result = insert(item, root, true);
+    std::pair<iterator, bool> result = insert(item, true);
     if (result.second == true) increaseSize();
     return result;
   }
 
+  // Looks key up and, on a miss, links a node whose value is constructed
+  // from args at the leaf where the search ended. Nothing is built on a hit.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> findOrEmplace(const K &key, Args &&...args) {
+    Node *parent = nullptr;
+    Node **link = &root;
+    while (*link != nullptr) {
+      parent = *link;
+      if (compare_Keys(key, parent->data)) {
+        link = &parent->left;
+      } else if (compare_Keys(parent->data, key)) {
+        link = &parent->right;
+      } else {
+        return {iterator(parent, root), false};
+      }
+    }
+    Node *inserted = pool_.create(std::in_place, std::forward<Args>(args)...);
+    inserted->parent = parent;
+    *link = inserted;
+    rebalanceUp(parent);
+    increaseSize();
+    return {iterator(inserted, root), true};
+  }
+
   std::pair<iterator, bool> insertNonUnique(value_type item) {
-    std::pair<iterator, bool> result = insert(item, root, false);
+    std::pair<iterator, bool> result = insert(item, false);
     if (result.second == true) increaseSize();
     return result;
   }
 
-  std::pair<iterator, bool> insert(value_type item, Node *n, bool isUnique) {
-    std::pair<iterator, bool> result = {iterator(n, root), true};
+  // Replaces the contents with [first, last) in O(n) when the range is
+  // already ordered: the nodes are created in order in a single pass and
+  // linked into a perfectly balanced tree. Other ranges are sorted into a
+  // buffer first. Of equal keys only the first is kept when isUnique is set.
+  template <typename InputIt>
+  void assignSorted(InputIt first, InputIt last, bool isUnique) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    auto less = [this](const value_type &a, const value_type &b) {
+      return compare_Keys(a, b);
+    };
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+      if (std::is_sorted(first, last, less)) {
+        buildSorted(first, last, isUnique);
+        return;
+      }
+    }
+    std::vector<value_type> items(first, last);
+    std::stable_sort(items.begin(), items.end(), less);
+    buildSorted(std::make_move_iterator(items.begin()),
+                std::make_move_iterator(items.end()), isUnique);
+  }
+
+  // Descends iteratively to the insertion point; equal keys go to the right
+  // subtree unless isUnique is set, in which case the existing node is
+  // returned.
+  std::pair<iterator, bool> insert(const value_type &item, bool isUnique) {
     if (this->empty()) {
-      root->data = item;
-      return result;
+      root = pool_.create(item);
+      return {iterator(root, root), true};
     }
-    if (compare_Keys(item, n->data)) {
-      if (n->left == nullptr) {
-        n->left = new Node(item);
-        n->left->parent = n;
-      } else {
-        result = insert(item, n->left, isUnique);
-      }
-    } else if (compare_Keys(n->data, item)) {
-      if (n->right == nullptr) {
-        n->right = new Node(item);
-        n->right->parent = n;
-      } else {
-        result = insert(item, n->right, isUnique);
-      }
-    } else {
-      if (isUnique == true) {
-        result = {iterator(n, root), false};
-      } else {
+    Node *n = root;
+    Node *inserted = nullptr;
+    while (inserted == nullptr) {
+      if (compare_Keys(item, n->data)) {
+        if (n->left == nullptr) {
+          inserted = n->left = pool_.create(item);
+        } else {
+          n = n->left;
+        }
+      } else if (!isUnique || compare_Keys(n->data, item)) {
         if (n->right == nullptr) {
-          n->right = new Node(item);
-          n->right->parent = n;
+          inserted = n->right = pool_.create(item);
         } else {
-          result = insert(item, n->right, isUnique);
+          n = n->right;
         }
+      } else {
+        return {iterator(n, root), false};
       }
     }
-    balance(n);
-    return result;
+    inserted->parent = n;
+    rebalanceUp(n);
+    return {iterator(inserted, root), true};
   }
 
   void balance(Node *node) {
-    node->updateHeight();
+    node->update();
     int temp = node->bfactor();
     if (temp == 2) {
-      if (node->right != nullptr) {
-        if (node->right->bfactor() < 0) node->right = rotateRight(node->right);
-      }
-      node = rotateLeft(node);
+      if (node->right->bfactor() < 0) rotateRight(node->right);
+      rotateLeft(node);
+    } else if (temp == -2) {
+      if (node->left->bfactor() > 0) rotateLeft(node->left);
+      rotateRight(node);
     }
-    if (temp == -2) {
-      if (node->left != nullptr) {
-        if (node->left->bfactor() > 0) node->left = rotateLeft(node->left);
-      }
-      node = rotateRight(node);
+  }
+
+  // Walks from node up to the root restoring heights, subtree sizes and the
+  // AVL invariant.
+  void rebalanceUp(Node *node) {
+    while (node != nullptr) {
+      Node *parent = node->parent;
+      balance(node);
+      node = parent;
     }
   }
 
@@ -152,9 +259,10 @@ class BinaryTree {
 
     p->left = q->right;
     q->right = p;
-    if (p->left) p->left->parent = q;
+    if (p->left) p->left->parent = p;
     p->parent = q;
-    q->updateHeight();
+    p->update();
+    q->update();
     return q;
   }
 
@@ -172,16 +280,37 @@ class BinaryTree {
     p->left = q;
     if (q->right) q->right->parent = q;
     q->parent = p;
-    p->updateHeight();
+    q->update();
+    p->update();
     return p;
   }
 
-  bool contains(const key_ &key) const {
-    return root->search(key) ? true : false;
+  // The lookup family is templated on the probe type: with a transparent
+  // compare_ any type comparable with the stored values can be used without
+  // materializing a key_.
+  template <typename K>
+  Node *search(const K &key) const {
+    Node *node = root;
+    while (node != nullptr) {
+      if (compare_Keys(node->data, key)) {
+        node = node->right;
+      } else if (compare_Keys(key, node->data)) {
+        node = node->left;
+      } else {
+        break;
+      }
+    }
+    return node;
+  }
+
+  template <typename K>
+  bool contains(const K &key) const {
+    return search(key) ? true : false;
   }
 
-  iterator find(const key_ &key) const {
-    iterator it(root->search(key), root);
+  template <typename K>
+  iterator find(const K &key) const {
+    iterator it(search(key), root);
     if (it.iter == nullptr) throw std::out_of_range("no key found");
     return it;
   }
@@ -191,24 +320,38 @@ class BinaryTree {
 
   void erase(iterator pos) {
     Node *p = pos.iter;
-    Node *newNode = remove(p);
-    delete p;
+    Node *changed = remove(p);
+    pool_.destroy(p);
     p = nullptr;
-    if (newNode) balance(newNode);
-    if (!root) root = new Node();
+    rebalanceUp(changed);
     decreaseSize();
   }
 
+  // Unlinks p from the tree and returns the lowest node whose subtree
+  // changed, i.e. the first ancestor that may need rebalancing.
   Node *remove(Node *p) {
-    Node *newNode = nullptr;
-    if (p == nullptr) return newNode;
+    if (p == nullptr) return nullptr;
 
+    Node *newNode = nullptr;
+    Node *changed = p->parent;
     if (p->left != nullptr && p->right != nullptr) {
-      newNode = removeTwoChildNode(p);
-    } else if ((p->left == nullptr) xor (p->right == nullptr)) {
-      newNode = removeOneChildNode(p);
+      newNode = p->left->getMax();
+      if (newNode == p->left) {
+        changed = newNode;
+      } else {
+        changed = newNode->parent;
+        changed->right = newNode->left;
+        if (newNode->left) newNode->left->parent = changed;
+        newNode->left = p->left;
+        newNode->left->parent = newNode;
+      }
+      newNode->right = p->right;
+      newNode->right->parent = newNode;
+    } else {
+      newNode = (p->left != nullptr) ? p->left : p->right;
     }
 
+    if (newNode) newNode->parent = p->parent;
     if (p != root) {
       (p->parent->left == p) ? p->parent->left = newNode
                              : p->parent->right = newNode;
@@ -216,49 +359,137 @@ class BinaryTree {
       root = newNode;
     }
 
-    return newNode;
+    return changed;
   }
 
-  Node *removeOneChildNode(Node *p) {
-    Node *newNode = (p->left == nullptr) ? p->right : p->left->getMax();
-    newNode->parent = p->parent;
-    return newNode;
+  // Releases the whole node arena at once; nodes are visited only when
+  // their values have destructors to run.
+  void clearTree() {
+    if (!std::is_trivially_destructible<Node>::value) clearNode(root);
+    pool_.release();
+    root = nullptr;
+    size_ = 0;
+  }
+
+  // Copies the subtree of other without recursion, walking the source
+  // through its parent links. With Move the values are moved out of the
+  // source nodes instead, which then only remain to be freed. If a value
+  // copy throws, the nodes built so far are destroyed again.
+  template <bool Move = false>
+  Node *copyNode(const Node *other, Node *parent) {
+    if (other == nullptr) return nullptr;
+    Node *result = cloneNode<Move>(other, parent);
+    const Node *from = other;
+    Node *to = result;
+    try {
+      while (true) {
+        if (from->left != nullptr && to->left == nullptr) {
+          to->left = cloneNode<Move>(from->left, to);
+          from = from->left;
+          to = to->left;
+        } else if (from->right != nullptr && to->right == nullptr) {
+          to->right = cloneNode<Move>(from->right, to);
+          from = from->right;
+          to = to->right;
+        } else if (from != other) {
+          from = from->parent;
+          to = to->parent;
+        } else {
+          break;
+        }
+      }
+    } catch (...) {
+      clearNode(result);
+      throw;
+    }
+    return result;
   }
 
-  Node *removeTwoChildNode(Node *p) {
-    Node *maxInLeft = p->left->getMax();
-    Node *newNode = maxInLeft;
-
-    newNode->right = p->right;
-    if (p->right) newNode->right->parent = newNode;
-
-    maxInLeft->parent->right = maxInLeft->left;
-    if (maxInLeft->left) maxInLeft->left->parent = maxInLeft->parent;
-
-    newNode->parent = p->parent;
-
-    if (p->left != newNode) {
-      newNode->left = p->left;
-      newNode->left->parent = newNode;
+  template <typename ForwardIt>
+  void buildSorted(ForwardIt first, ForwardIt last, bool isUnique) {
+    clearTree();
+    // The new nodes are chained in order through their right links.
+    Node *chain = nullptr;
+    Node *tail = nullptr;
+    size_type count = 0;
+    try {
+      for (; first != last; ++first) {
+        Node *node = pool_.create(*first);
+        if (isUnique && tail != nullptr &&
+            !compare_Keys(tail->data, node->data)) {
+          pool_.destroy(node);
+          continue;
+        }
+        (tail == nullptr ? chain : tail->right) = node;
+        tail = node;
+        ++count;
+      }
+    } catch (...) {
+      while (chain != nullptr) {
+        Node *next = chain->right;
+        pool_.destroy(chain);
+        chain = next;
+      }
+      throw;
     }
-
-    return newNode;
+    root = linkBalanced(chain, count);
+    size_ = count;
+  }
+
+  // Turns the first n nodes of the chain into a perfectly balanced subtree
+  // and advances chain past them. The depth is log2(n).
+  static Node *linkBalanced(Node *&chain, size_type n) {
+    if (n == 0) return nullptr;
+    Node *left = linkBalanced(chain, n / 2);
+    Node *node = chain;
+    chain = chain->right;
+    node->left = left;
+    if (left != nullptr) left->parent = node;
+    node->right = linkBalanced(chain, n - n / 2 - 1);
+    if (node->right != nullptr) node->right->parent = node;
+    node->update();
+    return node;
+  }
+
+  template <bool Move = false>
+  Node *cloneNode(const Node *other, Node *parent) {
+    Node *copy = nullptr;
+    if constexpr (Move) {
+      copy = pool_.create(std::move(const_cast<Node *>(other)->data));
+    } else {
+      copy = pool_.create(other->data);
+    }
+    copy->height = other->height;
+    copy->subtreeSize = other->subtreeSize;
+    copy->parent = parent;
+    return copy;
   }
 
-  void clearTree() {
-    if (root) {
-      size_ = 0;
-      root->clearNode(root);
+  // Destroys the subtree in O(1) extra space: left children are rotated up
+  // until the current node has none, then it is freed and the walk continues
+  // to its right.
+  void clearNode(Node *node) {
+    while (node != nullptr) {
+      if (node->left != nullptr) {
+        Node *left = node->left;
+        node->left = left->right;
+        left->right = node;
+        node = left;
+      } else {
+        Node *right = node->right;
+        pool_.destroy(node);
+        node = right;
+      }
     }
-    root = new Node();
   }
 
-  iterator findLowerBound(const_reference key) const {
+  template <typename K>
+  iterator findLowerBound(const K &key) const {
     Node *start = root;
     Node *result = nullptr;
 
     while (start != nullptr) {
-      if ((start->data >= key)) {
+      if (!compare_Keys(start->data, key)) {
         result = start;
         start = start->left;
       } else {
@@ -268,11 +499,12 @@ class BinaryTree {
     return iterator(result, root);
   }
 
-  iterator findUpperBound(const_reference key) const {
+  template <typename K>
+  iterator findUpperBound(const K &key) const {
     Node *start = root;
     Node *result = nullptr;
     while (start != nullptr) {
-      if (start->data > key) {
+      if (compare_Keys(key, start->data)) {
         result = start;
         start = start->left;
       } else
@@ -282,15 +514,70 @@ class BinaryTree {
     return iterator(result, root);
   }
 
-  size_type count(const key_ &key) const noexcept {
-    return root->countNonUnique(key);
+  template <typename K>
+  size_type count(const K &key) const {
+    return rankUpper(key) - rankLower(key);
   }
 
-  iterator at(const key_ &key) const {
-    return iterator(root->getPair(key), root);
+  // Number of elements ordered before key, i.e. the index of lower_bound.
+  template <typename K>
+  size_type rankLower(const K &key) const {
+    size_type rank = 0;
+    for (Node *node = root; node != nullptr;) {
+      if (compare_Keys(node->data, key)) {
+        rank += Node::getSize(node->left) + 1;
+        node = node->right;
+      } else {
+        node = node->left;
+      }
+    }
+    return rank;
   }
-  bool containsPair(const key_ &key) const {
-    return root->getPair(key) ? true : false;
+
+  // Number of elements not ordered after key, i.e. the index of upper_bound.
+  template <typename K>
+  size_type rankUpper(const K &key) const {
+    size_type rank = 0;
+    for (Node *node = root; node != nullptr;) {
+      if (compare_Keys(key, node->data)) {
+        node = node->left;
+      } else {
+        rank += Node::getSize(node->left) + 1;
+        node = node->right;
+      }
+    }
+    return rank;
+  }
+
+  // Element with in-order index k, end() when k is out of range.
+  iterator nth(size_type k) const {
+    Node *node = root;
+    while (node != nullptr) {
+      size_type leftSize = Node::getSize(node->left);
+      if (k < leftSize) {
+        node = node->left;
+      } else if (k == leftSize) {
+        break;
+      } else {
+        k -= leftSize + 1;
+        node = node->right;
+      }
+    }
+    return iterator(node, root);
+  }
+
+  // Key lookups for map: compare_ orders stored pairs against bare keys, so
+  // these descend a single root-to-leaf path like search.
+  template <typename K>
+  iterator at(const K &key) const {
+    Node *node = search(key);
+    if (node == nullptr) throw std::out_of_range("no key found");
+    return iterator(node, root);
+  }
+
+  template <typename K>
+  bool containsPair(const K &key) const {
+    return search(key) ? true : false;
   }
 
   Node *getRoot() const noexcept { return root; }
@@ -376,22 +663,20 @@ class BinaryTree {
  private:
   Node *root;
   size_type size_;
-  compare_ compare_Keys;
+  NodePool<Node, Allocator> pool_;
 };
 
-template <typename key_, typename value_, typename compare_>
-class BinaryTree<key_, value_, compare_>::Node {
+template <typename key_, typename value_, typename compare_,
+          typename Allocator>
+class BinaryTree<key_, value_, compare_, Allocator>::Node {
  public:
-  Node() = default;
-  Node(value_type data_) : data(data_) {}
-
-  Node *copyNode(const Node *other) {
-    Node *copy = new Node{other->data};
-    if (other->left) copy->left = copy->copyNode(other->left);
-    if (other->right) copy->right = copy->copyNode(other->right);
-    copy->parent = this;
-    return copy;
-  }
+  Node() : subtreeSize(1), height(1) {}
+  Node(const value_type &data_) : data(data_), subtreeSize(1), height(1) {}
+  Node(value_type &&data_)
+      : data(std::move(data_)), subtreeSize(1), height(1) {}
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args &&...args)
+      : data(std::forward<Args>(args)...), subtreeSize(1), height(1) {}
 
   Node *moveForward() const {
     Node *p = const_cast<Node *>(this);
@@ -418,69 +703,49 @@ class BinaryTree<key_, value_, compare_>::Node {
         p = tempParent;
         tempParent = tempParent->parent;
       }
-      p = parent;
+      p = tempParent;
     }
     return p;
   }
 
   Node *getMin() {
-    if (left == nullptr) return this;
-    return left->getMin();
+    Node *node = this;
+    while (node->left != nullptr) node = node->left;
+    return node;
   }
 
   Node *getMax() {
-    if (right == nullptr) return this;
-    return right->getMax();
+    Node *node = this;
+    while (node->right != nullptr) node = node->right;
+    return node;
   }
 
-  int updateHeight() {
-    int left_height = (left == nullptr) ? 0 : left->updateHeight();
-    int right_height = (right == nullptr) ? 0 : right->updateHeight();
-    height = 1 + std::max(left_height, right_height);
-    return height;
+  // Recomputes height and subtree size from the children only, O(1).
+  void update() noexcept {
+    height = 1 + std::max(getHeight(left), getHeight(right));
+    subtreeSize = 1 + getSize(left) + getSize(right);
   }
 
-  int getHeight() const { return (this != nullptr) ? height : 0; }
-
-  int bfactor() const { return right->getHeight() - left->getHeight(); }
-
-  Node *search(const key_ &key) {
-    if (data < key) {
-      return (right == nullptr) ? nullptr : right->search(key);
-    } else if (data > key) {
-      return (left == nullptr) ? nullptr : left->search(key);
-    } else {
-      return this;
-    }
+  static size_type getSize(const Node *node) noexcept {
+    return (node != nullptr) ? static_cast<size_type>(node->subtreeSize) : 0;
   }
 
-  size_type countNonUnique(const key_ &key) const noexcept {
-    size_type count_left = (left == nullptr) ? 0 : left->countNonUnique(key);
-    size_type count_right = (right == nullptr) ? 0 : right->countNonUnique(key);
-    return (data == key ? 1 : 0) + count_left + count_right;
+  static int getHeight(const Node *node) noexcept {
+    return (node != nullptr) ? static_cast<int>(node->height) : 0;
   }
 
-  Node *getPair(const key_ &key) {
-    Node *left_res = (left == nullptr) ? nullptr : left->getPair(key);
-    Node *right_res = (right == nullptr) ? nullptr : right->getPair(key);
-    if (data.first == key) return this;
-    return (data.first < key) ? right_res : left_res;
-  }
-
-  void clearNode(Node *node) {
-    if (node != nullptr) {
-      clearNode(node->left);
-      clearNode(node->right);
-      delete node;
-      node = nullptr;
-    }
-  }
+  int bfactor() const noexcept { return getHeight(right) - getHeight(left); }
 
   value_type data;
   Node *left = nullptr;
   Node *right = nullptr;
   Node *parent = nullptr;
-  int height = 0;
+  // Packed into one 64-bit word so the augmentation does not grow the node
+  // on 64-bit targets. The fixed-width type keeps the bit-fields valid where
+  // size_t is 32 bits; 56 bits hold any node count and 8 bits any AVL
+  // height.
+  std::uint64_t subtreeSize : 56;
+  std::uint64_t height : 8;
 };
 }  // namespace s21
 
@@ -0,0 +1,698 @@
+#ifndef SRC_S21_BTREE_H_
+#define SRC_S21_BTREE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utility.h"
+
+namespace s21 {
+// Cache-conscious ordered storage for btree_map and btree_set. Every node
+// holds up to kNodeSlots sorted values in about kTargetNodeSize bytes, so a
+// lookup touches a handful of nodes instead of one node per level, and the
+// per-value overhead is a fraction of a pointer. Internal nodes additionally
+// hold kNodeSlots + 1 children. Keys are unique.
+template <typename key_, typename value_, typename compare_,
+          typename Allocator = std::allocator<value_>>
+class BTree : private EboStorage<compare_> {
+ public:
+  struct LeafNode;
+  struct InternalNode;
+  template <bool Const>
+  struct btreeIterator;
+
+  using key_type = key_;
+  using value_type = value_;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using iterator = btreeIterator<false>;
+  using const_iterator = btreeIterator<true>;
+  using allocator_type = Allocator;
+
+  static constexpr size_type kTargetNodeSize = 256;
+  static constexpr size_type kNodeHeader = 16;
+  static constexpr size_type kNodeSlots = std::max<size_type>(
+      3, std::min<size_type>((kTargetNodeSize - kNodeHeader) /
+                                 sizeof(value_type),
+                             std::numeric_limits<std::uint16_t>::max() - 1));
+  static constexpr size_type kMinSlots = kNodeSlots / 2;
+
+  struct LeafNode {
+    value_type *slot(size_type i) noexcept {
+      return std::launder(reinterpret_cast<value_type *>(storage)) + i;
+    }
+
+    InternalNode *parent;
+    std::uint16_t position;
+    std::uint16_t count;
+    bool leaf;
+    alignas(value_type) unsigned char storage[kNodeSlots * sizeof(value_type)];
+  };
+
+  struct InternalNode : LeafNode {
+    LeafNode *children[kNodeSlots + 1];
+  };
+
+  BTree() = default;
+
+  explicit BTree(const compare_ &comp, const Allocator &alloc = Allocator())
+      : EboStorage<compare_>(comp), leafAlloc_(alloc), internalAlloc_(alloc) {}
+
+  BTree(const BTree &other)
+      : EboStorage<compare_>(other.value_comp()),
+        leafAlloc_(leaf_traits::select_on_container_copy_construction(
+            other.leafAlloc_)),
+        internalAlloc_(internal_traits::select_on_container_copy_construction(
+            other.internalAlloc_)) {
+    copyFrom(other);
+  }
+
+  BTree(BTree &&other) noexcept
+      : EboStorage<compare_>(std::move(other.value_comp())),
+        leafAlloc_(std::move(other.leafAlloc_)),
+        internalAlloc_(std::move(other.internalAlloc_)) {
+    steal(other);
+  }
+
+  BTree &operator=(const BTree &other) {
+    if (this != &other) {
+      clear();
+      value_comp() = other.value_comp();
+      if constexpr (leaf_traits::propagate_on_container_copy_assignment::
+                        value) {
+        leafAlloc_ = other.leafAlloc_;
+        internalAlloc_ = other.internalAlloc_;
+      }
+      copyFrom(other);
+    }
+    return *this;
+  }
+
+  // Takes the nodes of other when its allocators can free them, moves the
+  // values one by one into nodes of this tree otherwise.
+  BTree &operator=(BTree &&other) noexcept(
+      leaf_traits::propagate_on_container_move_assignment::value ||
+      leaf_traits::is_always_equal::value) {
+    if (this != &other) {
+      clear();
+      value_comp() = std::move(other.value_comp());
+      if (leaf_traits::propagate_on_container_move_assignment::value ||
+          leafAlloc_ == other.leafAlloc_) {
+        if constexpr (leaf_traits::propagate_on_container_move_assignment::
+                          value) {
+          leafAlloc_ = std::move(other.leafAlloc_);
+          internalAlloc_ = std::move(other.internalAlloc_);
+        }
+        steal(other);
+      } else {
+        moveFrom(other);
+      }
+    }
+    return *this;
+  }
+
+  ~BTree() { clear(); }
+
+  compare_ &value_comp() noexcept { return EboStorage<compare_>::get(); }
+  const compare_ &value_comp() const noexcept {
+    return EboStorage<compare_>::get();
+  }
+
+  template <typename A, typename B>
+  bool compare_Keys(const A &a, const B &b) const {
+    return value_comp()(a, b);
+  }
+
+  allocator_type get_allocator() const { return allocator_type(leafAlloc_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / 2 / sizeof(LeafNode) *
+           kMinSlots;
+  }
+
+  // Bytes held by the nodes of the tree.
+  size_type memory_usage() const noexcept {
+    return leafCount_ * sizeof(LeafNode) +
+           internalCount_ * sizeof(InternalNode);
+  }
+
+  iterator begin() noexcept { return iterator(leftmost_, 0); }
+  iterator end() noexcept { return endIterator(); }
+  const_iterator begin() const noexcept { return const_iterator(leftmost_, 0); }
+  const_iterator end() const noexcept { return endIterator(); }
+
+  template <typename V>
+  std::pair<iterator, bool> insertUnique(V &&item) {
+    if (root_ == nullptr) {
+      root_ = leftmost_ = rightmost_ = newLeaf();
+      return {insertAt(root_, 0, std::forward<V>(item)), true};
+    }
+    // Keys arriving in ascending order skip the descent.
+    if (compare_Keys(*rightmost_->slot(rightmost_->count - 1), item)) {
+      return {insertAt(rightmost_, rightmost_->count, std::forward<V>(item)),
+              true};
+    }
+    LeafNode *node = root_;
+    while (true) {
+      size_type pos = lowerBoundIn(node, item);
+      if (pos < node->count && !compare_Keys(item, *node->slot(pos))) {
+        return {iterator(node, pos), false};
+      }
+      if (node->leaf) return {insertAt(node, pos, std::forward<V>(item)), true};
+      node = child(node, pos);
+    }
+  }
+
+  // Bulk load: items strictly above the current maximum are appended with
+  // splits that leave the left node full, others take the regular path.
+  // Nodes come out nearly full instead of half full.
+  template <typename InputIt>
+  void insertSorted(InputIt first, InputIt last) {
+    for (; first != last; ++first) {
+      if (root_ == nullptr ||
+          compare_Keys(*rightmost_->slot(rightmost_->count - 1), *first)) {
+        appendBack(*first);
+      } else {
+        insertUnique(*first);
+      }
+    }
+    fixRightSpine();
+  }
+
+  template <typename K>
+  iterator find(const K &key) const {
+    LeafNode *node = root_;
+    while (node != nullptr) {
+      size_type pos = lowerBoundIn(node, key);
+      if (pos < node->count && !compare_Keys(key, *node->slot(pos))) {
+        return iterator(node, pos);
+      }
+      if (node->leaf) break;
+      node = child(node, pos);
+    }
+    return endIterator();
+  }
+
+  template <typename K>
+  bool contains(const K &key) const {
+    return find(key) != endIterator();
+  }
+
+  // The deepest node with an element not ordered before key holds the
+  // answer.
+  template <typename K>
+  iterator findLowerBound(const K &key) const {
+    iterator result = endIterator();
+    LeafNode *node = root_;
+    while (node != nullptr) {
+      size_type pos = lowerBoundIn(node, key);
+      if (pos < node->count) result = iterator(node, pos);
+      if (node->leaf) break;
+      node = child(node, pos);
+    }
+    return result;
+  }
+
+  template <typename K>
+  iterator findUpperBound(const K &key) const {
+    iterator result = endIterator();
+    LeafNode *node = root_;
+    while (node != nullptr) {
+      size_type pos = upperBoundIn(node, key);
+      if (pos < node->count) result = iterator(node, pos);
+      if (node->leaf) break;
+      node = child(node, pos);
+    }
+    return result;
+  }
+
+  void erase(const_iterator pos) {
+    LeafNode *node = pos.node_;
+    size_type i = pos.position_;
+    if (!node->leaf) {
+      // Replace the separator by its in-order predecessor from a leaf.
+      LeafNode *leaf = child(node, i);
+      while (!leaf->leaf) leaf = child(leaf, leaf->count);
+      destroy(node->slot(i));
+      transfer(node->slot(i), leaf->slot(leaf->count - 1));
+      --leaf->count;
+      node = leaf;
+    } else {
+      destroy(node->slot(i));
+      for (; i + 1 < node->count; ++i) {
+        transfer(node->slot(i), node->slot(i + 1));
+      }
+      --node->count;
+    }
+    --size_;
+    rebalanceAfterErase(node);
+    updateEdges();
+  }
+
+  void clear() noexcept {
+    if (root_ != nullptr) clearNode(root_);
+    root_ = leftmost_ = rightmost_ = nullptr;
+    size_ = 0;
+  }
+
+  void swap(BTree &other) noexcept {
+    std::swap(value_comp(), other.value_comp());
+    if constexpr (leaf_traits::propagate_on_container_swap::value) {
+      std::swap(leafAlloc_, other.leafAlloc_);
+      std::swap(internalAlloc_, other.internalAlloc_);
+    } else {
+      S21_CONTAINERS_ASSERT(leafAlloc_ == other.leafAlloc_,
+                            "swapping trees with unequal allocators");
+    }
+    std::swap(root_, other.root_);
+    std::swap(leftmost_, other.leftmost_);
+    std::swap(rightmost_, other.rightmost_);
+    std::swap(size_, other.size_);
+    std::swap(leafCount_, other.leafCount_);
+    std::swap(internalCount_, other.internalCount_);
+  }
+
+  // Bidirectional iterator over (node, position); end() is one past the
+  // last value of the rightmost leaf so that --end() works.
+  template <bool Const>
+  struct btreeIterator {
+    using ref = std::conditional_t<Const, const_reference, reference>;
+    using ptr = std::conditional_t<Const, const value_type *, value_type *>;
+
+    btreeIterator() = default;
+    btreeIterator(LeafNode *node, int position)
+        : node_(node), position_(position) {}
+
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    btreeIterator(const btreeIterator<false> &other)
+        : node_(other.node_), position_(other.position_) {}
+
+    ref operator*() const { return *node_->slot(position_); }
+    ptr operator->() const { return node_->slot(position_); }
+
+    btreeIterator &operator++() {
+      if (node_->leaf) {
+        if (++position_ < node_->count) return *this;
+        LeafNode *node = node_;
+        int position = position_;
+        while (position_ == node_->count && node_->parent != nullptr) {
+          position_ = node_->position;
+          node_ = node_->parent;
+        }
+        if (position_ == node_->count) {
+          node_ = node;
+          position_ = position;
+        }
+      } else {
+        node_ = child(node_, position_ + 1);
+        while (!node_->leaf) node_ = child(node_, 0);
+        position_ = 0;
+      }
+      return *this;
+    }
+
+    btreeIterator &operator--() {
+      if (node_->leaf) {
+        if (--position_ >= 0) return *this;
+        LeafNode *node = node_;
+        int position = position_;
+        while (position_ < 0 && node_->parent != nullptr) {
+          position_ = node_->position - 1;
+          node_ = node_->parent;
+        }
+        if (position_ < 0) {
+          node_ = node;
+          position_ = position;
+        }
+      } else {
+        node_ = child(node_, position_);
+        while (!node_->leaf) node_ = child(node_, node_->count);
+        position_ = node_->count - 1;
+      }
+      return *this;
+    }
+
+    btreeIterator operator++(int) {
+      btreeIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    btreeIterator operator--(int) {
+      btreeIterator old = *this;
+      --*this;
+      return old;
+    }
+
+    bool operator==(const btreeIterator &other) const noexcept {
+      return node_ == other.node_ && position_ == other.position_;
+    }
+
+    bool operator!=(const btreeIterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+    LeafNode *node_ = nullptr;
+    int position_ = 0;
+  };
+
+ private:
+  using leaf_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<LeafNode>;
+  using internal_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<InternalNode>;
+  using leaf_traits = std::allocator_traits<leaf_allocator>;
+  using internal_traits = std::allocator_traits<internal_allocator>;
+
+  static LeafNode *child(LeafNode *node, size_type i) noexcept {
+    return static_cast<InternalNode *>(node)->children[i];
+  }
+
+  static void setChild(LeafNode *node, size_type i, LeafNode *c) noexcept {
+    static_cast<InternalNode *>(node)->children[i] = c;
+    c->parent = static_cast<InternalNode *>(node);
+    c->position = static_cast<std::uint16_t>(i);
+  }
+
+  iterator endIterator() const noexcept {
+    return iterator(rightmost_, rightmost_ ? rightmost_->count : 0);
+  }
+
+  static void destroy(value_type *p) noexcept { p->~value_type(); }
+
+  // Moves the value at src into the raw slot dst and ends the life of src.
+  static void transfer(value_type *dst, value_type *src) {
+    ::new (static_cast<void *>(dst)) value_type(std::move(*src));
+    src->~value_type();
+  }
+
+  template <typename K>
+  size_type lowerBoundIn(LeafNode *node, const K &key) const {
+    size_type lo = 0;
+    size_type hi = node->count;
+    while (lo < hi) {
+      size_type mid = (lo + hi) / 2;
+      if (compare_Keys(*node->slot(mid), key)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  template <typename K>
+  size_type upperBoundIn(LeafNode *node, const K &key) const {
+    size_type lo = 0;
+    size_type hi = node->count;
+    while (lo < hi) {
+      size_type mid = (lo + hi) / 2;
+      if (compare_Keys(key, *node->slot(mid))) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    return lo;
+  }
+
+  LeafNode *newLeaf() {
+    LeafNode *node = leaf_traits::allocate(leafAlloc_, 1);
+    ::new (static_cast<void *>(node)) LeafNode;
+    node->parent = nullptr;
+    node->position = 0;
+    node->count = 0;
+    node->leaf = true;
+    ++leafCount_;
+    return node;
+  }
+
+  InternalNode *newInternal() {
+    InternalNode *node = internal_traits::allocate(internalAlloc_, 1);
+    ::new (static_cast<void *>(node)) InternalNode;
+    node->parent = nullptr;
+    node->position = 0;
+    node->count = 0;
+    node->leaf = false;
+    ++internalCount_;
+    return node;
+  }
+
+  void freeNode(LeafNode *node) noexcept {
+    if (node->leaf) {
+      leaf_traits::deallocate(leafAlloc_, node, 1);
+      --leafCount_;
+    } else {
+      internal_traits::deallocate(internalAlloc_,
+                                  static_cast<InternalNode *>(node), 1);
+      --internalCount_;
+    }
+  }
+
+  template <typename V>
+  iterator insertAt(LeafNode *leaf, size_type pos, V &&item) {
+    value_type value(std::forward<V>(item));
+    if (leaf->count == kNodeSlots) {
+      split(leaf, kMinSlots, false);
+      if (pos > kMinSlots) {
+        pos -= kMinSlots + 1;
+        leaf = child(leaf->parent, leaf->position + 1);
+      }
+    }
+    for (size_type i = leaf->count; i > pos; --i) {
+      transfer(leaf->slot(i), leaf->slot(i - 1));
+    }
+    ::new (static_cast<void *>(leaf->slot(pos))) value_type(std::move(value));
+    ++leaf->count;
+    ++size_;
+    updateEdges();
+    return iterator(leaf, pos);
+  }
+
+  template <typename V>
+  void appendBack(V &&item) {
+    if (root_ == nullptr) root_ = leftmost_ = rightmost_ = newLeaf();
+    LeafNode *leaf = rightmost_;
+    if (leaf->count == kNodeSlots) {
+      split(leaf, leaf->count - 1, true);
+      leaf = child(leaf->parent, leaf->position + 1);
+      rightmost_ = leaf;
+    }
+    ::new (static_cast<void *>(leaf->slot(leaf->count)))
+        value_type(std::forward<V>(item));
+    ++leaf->count;
+    ++size_;
+  }
+
+  // Splits a full node: the values after index at move to a new right
+  // sibling and the value at index at moves up into the parent, which is
+  // split first when it is full as well.
+  void split(LeafNode *node, size_type at, bool append) {
+    InternalNode *parent = node->parent;
+    if (parent == nullptr) {
+      parent = newInternal();
+      setChild(parent, 0, node);
+      root_ = parent;
+    } else if (parent->count == kNodeSlots) {
+      split(parent, append ? parent->count - 1 : kMinSlots, append);
+      parent = node->parent;
+    }
+    LeafNode *sibling = node->leaf ? newLeaf() : newInternal();
+    size_type moved = node->count - at - 1;
+    for (size_type j = 0; j < moved; ++j) {
+      transfer(sibling->slot(j), node->slot(at + 1 + j));
+    }
+    if (!node->leaf) {
+      for (size_type j = 0; j <= moved; ++j) {
+        setChild(sibling, j, child(node, at + 1 + j));
+      }
+    }
+    sibling->count = static_cast<std::uint16_t>(moved);
+
+    size_type p = node->position;
+    for (size_type j = parent->count; j > p; --j) {
+      transfer(parent->slot(j), parent->slot(j - 1));
+    }
+    for (size_type j = parent->count + 1; j > p + 1; --j) {
+      setChild(parent, j, child(parent, j - 1));
+    }
+    transfer(parent->slot(p), node->slot(at));
+    setChild(parent, p + 1, sibling);
+    ++parent->count;
+    node->count = static_cast<std::uint16_t>(at);
+  }
+
+  // Moves the last value of the left sibling up into the parent and the
+  // separator down to the front of node.
+  void rotateRight(LeafNode *node) {
+    InternalNode *parent = node->parent;
+    size_type p = node->position;
+    LeafNode *left = child(parent, p - 1);
+    for (size_type j = node->count; j > 0; --j) {
+      transfer(node->slot(j), node->slot(j - 1));
+    }
+    if (!node->leaf) {
+      for (size_type j = node->count + 1; j > 0; --j) {
+        setChild(node, j, child(node, j - 1));
+      }
+      setChild(node, 0, child(left, left->count));
+    }
+    transfer(node->slot(0), parent->slot(p - 1));
+    transfer(parent->slot(p - 1), left->slot(left->count - 1));
+    --left->count;
+    ++node->count;
+  }
+
+  void rotateLeft(LeafNode *node) {
+    InternalNode *parent = node->parent;
+    size_type p = node->position;
+    LeafNode *right = child(parent, p + 1);
+    transfer(node->slot(node->count), parent->slot(p));
+    transfer(parent->slot(p), right->slot(0));
+    if (!node->leaf) setChild(node, node->count + 1, child(right, 0));
+    for (size_type j = 0; j + 1 < right->count; ++j) {
+      transfer(right->slot(j), right->slot(j + 1));
+    }
+    if (!right->leaf) {
+      for (size_type j = 0; j < right->count; ++j) {
+        setChild(right, j, child(right, j + 1));
+      }
+    }
+    --right->count;
+    ++node->count;
+  }
+
+  // Folds the right sibling of left and their separator into left.
+  void mergeWithRight(LeafNode *left) {
+    InternalNode *parent = left->parent;
+    size_type p = left->position;
+    LeafNode *right = child(parent, p + 1);
+    transfer(left->slot(left->count), parent->slot(p));
+    for (size_type j = 0; j < right->count; ++j) {
+      transfer(left->slot(left->count + 1 + j), right->slot(j));
+    }
+    if (!left->leaf) {
+      for (size_type j = 0; j <= right->count; ++j) {
+        setChild(left, left->count + 1 + j, child(right, j));
+      }
+    }
+    left->count += 1 + right->count;
+    for (size_type j = p; j + 1 < parent->count; ++j) {
+      transfer(parent->slot(j), parent->slot(j + 1));
+    }
+    for (size_type j = p + 1; j < parent->count; ++j) {
+      setChild(parent, j, child(parent, j + 1));
+    }
+    --parent->count;
+    freeNode(right);
+  }
+
+  void rebalanceAfterErase(LeafNode *node) {
+    while (node != root_ && node->count < kMinSlots) {
+      InternalNode *parent = node->parent;
+      size_type p = node->position;
+      LeafNode *left = p > 0 ? child(parent, p - 1) : nullptr;
+      LeafNode *right = p < parent->count ? child(parent, p + 1) : nullptr;
+      if (left != nullptr && left->count > kMinSlots) {
+        rotateRight(node);
+        return;
+      }
+      if (right != nullptr && right->count > kMinSlots) {
+        rotateLeft(node);
+        return;
+      }
+      mergeWithRight(left != nullptr ? left : node);
+      node = parent;
+    }
+    if (root_->count == 0) {
+      LeafNode *old = root_;
+      root_ = old->leaf ? nullptr : child(old, 0);
+      if (root_ != nullptr) root_->parent = nullptr;
+      freeNode(old);
+    }
+  }
+
+  // After appendBack the nodes on the right spine may be nearly empty;
+  // refill them from their full left siblings.
+  void fixRightSpine() {
+    for (LeafNode *node = rightmost_; node != nullptr && node != root_;
+         node = node->parent) {
+      LeafNode *left = child(node->parent, node->position - 1);
+      while (node->count < kMinSlots && left->count > kMinSlots) {
+        rotateRight(node);
+      }
+    }
+    updateEdges();
+  }
+
+  void updateEdges() noexcept {
+    if (root_ == nullptr) {
+      leftmost_ = rightmost_ = nullptr;
+      return;
+    }
+    LeafNode *node = root_;
+    while (!node->leaf) node = child(node, 0);
+    leftmost_ = node;
+    node = root_;
+    while (!node->leaf) node = child(node, node->count);
+    rightmost_ = node;
+  }
+
+  void clearNode(LeafNode *node) noexcept {
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < node->count; ++i) destroy(node->slot(i));
+    }
+    if (!node->leaf) {
+      for (size_type i = 0; i <= node->count; ++i) clearNode(child(node, i));
+    }
+    freeNode(node);
+  }
+
+  void copyFrom(const BTree &other) {
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+      appendBack(*it);
+    }
+    fixRightSpine();
+  }
+
+  void moveFrom(BTree &other) {
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      appendBack(std::move(*it));
+    }
+    fixRightSpine();
+    other.clear();
+  }
+
+  void steal(BTree &other) noexcept {
+    root_ = other.root_;
+    leftmost_ = other.leftmost_;
+    rightmost_ = other.rightmost_;
+    size_ = other.size_;
+    leafCount_ = other.leafCount_;
+    internalCount_ = other.internalCount_;
+    other.root_ = other.leftmost_ = other.rightmost_ = nullptr;
+    other.size_ = other.leafCount_ = other.internalCount_ = 0;
+  }
+
+  leaf_allocator leafAlloc_;
+  internal_allocator internalAlloc_;
+  LeafNode *root_ = nullptr;
+  LeafNode *leftmost_ = nullptr;
+  LeafNode *rightmost_ = nullptr;
+  size_type size_ = 0;
+  size_type leafCount_ = 0;
+  size_type internalCount_ = 0;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_BTREE_H_
@@ -0,0 +1,210 @@
+#ifndef SRC_S21_BTREE_MAP_H_
+#define SRC_S21_BTREE_MAP_H_
+
+#include <array>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "s21_btree.h"
+
+namespace s21 {
+// Ordered map with the interface of s21::map, stored in a B-tree. Prefer it
+// for large maps of small keys that are looked up or scanned often: nodes
+// hold tens of pairs each, so there are far fewer cache misses per lookup
+// and far fewer bytes per key. Deliberate deviation from s21::map: any
+// insert or erase may shift pairs inside nodes or split and merge nodes,
+// so it invalidates every iterator into the map. Re-find keys after
+// modifying it.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
+class btree_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  struct mapCompare : EboStorage<Compare> {
+    using is_transparent = void;
+
+    mapCompare() = default;
+    explicit mapCompare(const Compare &comp) : EboStorage<Compare>(comp) {}
+
+    bool operator()(const value_type &a, const value_type &b) const {
+      return this->get()(a.first, b.first);
+    }
+
+    template <typename K>
+    bool operator()(const value_type &a, const K &b) const {
+      return this->get()(a.first, b);
+    }
+
+    template <typename K>
+    bool operator()(const K &a, const value_type &b) const {
+      return this->get()(a, b.first);
+    }
+  };
+
+  // Orders stored pairs by key, like std::map::value_compare.
+  using value_compare = mapCompare;
+
+  using tree_type = BTree<key_type, value_type, mapCompare, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  btree_map() = default;
+
+  explicit btree_map(const Allocator &alloc) : tree_(mapCompare(), alloc) {}
+
+  explicit btree_map(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_(mapCompare(comp), alloc) {}
+
+  btree_map(std::initializer_list<value_type> const &items) {
+    tree_.insertSorted(items.begin(), items.end());
+  }
+
+  // Sorted input is bulk loaded into nearly full nodes, anything else is
+  // inserted one by one.
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  btree_map(InputIt first, InputIt last) {
+    tree_.insertSorted(first, last);
+  }
+
+  btree_map(const btree_map &m) = default;
+  btree_map(btree_map &&m) noexcept = default;
+  btree_map &operator=(const btree_map &m) = default;
+  btree_map &operator=(btree_map &&m) = default;
+  ~btree_map() = default;
+
+  T &at(const Key &key) { return atImpl(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  T &at(const K &key) {
+    return atImpl(key);
+  }
+
+  T &operator[](const Key &key) {
+    iterator it = tree_.find(key);
+    if (it == end()) it = tree_.insertUnique(value_type{key, T()}).first;
+    return it->second;
+  }
+
+  iterator begin() noexcept { return tree_.begin(); }
+  iterator end() noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return tree_.begin(); }
+  const_iterator cend() const noexcept { return tree_.end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  // Bytes taken by the nodes, memory_usage() / size() is the cost per key.
+  size_type memory_usage() const noexcept { return tree_.memory_usage(); }
+
+  std::pair<iterator, bool> insert(const_reference value) {
+    return tree_.insertUnique(value);
+  }
+
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return tree_.insertUnique(value_type{key, obj});
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    std::pair<iterator, bool> result = insert(key, obj);
+    if (!result.second) result.first->second = obj;
+    return result;
+  }
+
+  // Replaces the contents by [first, last), bulk loading sorted input.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.clear();
+    tree_.insertSorted(first, last);
+  }
+
+  void erase(iterator pos) { tree_.erase(pos); }
+
+  size_type erase(const Key &key) {
+    iterator it = tree_.find(key);
+    if (it == end()) return 0;
+    tree_.erase(it);
+    return 1;
+  }
+
+  void swap(btree_map &other) noexcept { tree_.swap(other.tree_); }
+
+  void clear() noexcept { tree_.clear(); }
+
+  void merge(btree_map &other) {
+    for (iterator it = other.begin(); it != other.end(); ++it) insert(*it);
+    other.clear();
+  }
+
+  iterator find(const Key &key) { return tree_.find(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator find(const K &key) {
+    return tree_.find(key);
+  }
+
+  bool contains(const Key &key) const { return tree_.contains(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  bool contains(const K &key) const {
+    return tree_.contains(key);
+  }
+
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key &key) { return tree_.findLowerBound(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator lower_bound(const K &key) {
+    return tree_.findLowerBound(key);
+  }
+
+  iterator upper_bound(const Key &key) { return tree_.findUpperBound(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator upper_bound(const K &key) {
+    return tree_.findUpperBound(key);
+  }
+
+  key_compare key_comp() const { return tree_.value_comp().get(); }
+
+  value_compare value_comp() const { return tree_.value_comp(); }
+
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+  // Every insertion may move earlier elements inside their node, so the
+  // returned iterators are looked up once all of them are in.
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::array<bool, sizeof...(Args)> inserted{insert(args).second...};
+    std::vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(args));
+    std::size_t i = 0;
+    (result.emplace_back(find(static_cast<const_reference>(args).first),
+                         inserted[i++]),
+     ...);
+    return result;
+  }
+
+ private:
+  template <typename K>
+  T &atImpl(const K &key) {
+    iterator it = tree_.find(key);
+    if (it == end()) throw std::out_of_range("btree_map::at: no such key");
+    return it->second;
+  }
+
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_BTREE_MAP_H_
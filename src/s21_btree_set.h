@@ -0,0 +1,170 @@
+#ifndef SRC_S21_BTREE_SET_H_
+#define SRC_S21_BTREE_SET_H_
+
+#include <array>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "s21_btree.h"
+
+namespace s21 {
+// Ordered set with the interface of s21::set, stored in a B-tree.
+// Deliberate deviation from s21::set: any insert or erase may shift keys
+// inside nodes or split and merge nodes, so it invalidates every iterator
+// into the set. Keeping keys packed in nodes is what makes the B-tree
+// cheaper to search and scan; re-find keys after modifying the set.
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
+class btree_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Allocator;
+
+  struct setCompare : EboStorage<Compare> {
+    using is_transparent = void;
+
+    setCompare() = default;
+    explicit setCompare(const Compare &comp) : EboStorage<Compare>(comp) {}
+
+    template <typename A, typename B>
+    bool operator()(const A &a, const B &b) const {
+      return this->get()(a, b);
+    }
+  };
+
+  using tree_type = BTree<Key, Key, setCompare, Allocator>;
+  using iterator = typename tree_type::const_iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  btree_set() = default;
+
+  explicit btree_set(const Allocator &alloc) : tree_(setCompare(), alloc) {}
+
+  explicit btree_set(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_(setCompare(comp), alloc) {}
+
+  btree_set(std::initializer_list<value_type> const &items) {
+    tree_.insertSorted(items.begin(), items.end());
+  }
+
+  // Sorted input is bulk loaded into nearly full nodes, anything else is
+  // inserted one by one.
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  btree_set(InputIt first, InputIt last) {
+    tree_.insertSorted(first, last);
+  }
+
+  btree_set(const btree_set &s) = default;
+  btree_set(btree_set &&s) noexcept = default;
+  btree_set &operator=(const btree_set &s) = default;
+  btree_set &operator=(btree_set &&s) = default;
+  ~btree_set() = default;
+
+  iterator begin() const noexcept { return tree_.begin(); }
+  iterator end() const noexcept { return tree_.end(); }
+  const_iterator cbegin() const noexcept { return tree_.begin(); }
+  const_iterator cend() const noexcept { return tree_.end(); }
+
+  bool empty() const noexcept { return tree_.empty(); }
+  size_type size() const noexcept { return tree_.size(); }
+  size_type max_size() const noexcept { return tree_.max_size(); }
+
+  // Bytes taken by the nodes, memory_usage() / size() is the cost per key.
+  size_type memory_usage() const noexcept { return tree_.memory_usage(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insertUnique(value);
+  }
+
+  // Replaces the contents by [first, last), bulk loading sorted input.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.clear();
+    tree_.insertSorted(first, last);
+  }
+
+  void erase(iterator pos) { tree_.erase(pos); }
+
+  size_type erase(const Key &key) {
+    iterator it = tree_.find(key);
+    if (it == end()) return 0;
+    tree_.erase(it);
+    return 1;
+  }
+
+  void swap(btree_set &other) noexcept { tree_.swap(other.tree_); }
+
+  void clear() noexcept { tree_.clear(); }
+
+  void merge(btree_set &other) {
+    for (iterator it = other.begin(); it != other.end(); ++it) insert(*it);
+    other.clear();
+  }
+
+  iterator find(const Key &key) const { return tree_.find(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator find(const K &key) const {
+    return tree_.find(key);
+  }
+
+  bool contains(const Key &key) const { return tree_.contains(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  bool contains(const K &key) const {
+    return tree_.contains(key);
+  }
+
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key &key) const {
+    return tree_.findLowerBound(key);
+  }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator lower_bound(const K &key) const {
+    return tree_.findLowerBound(key);
+  }
+
+  iterator upper_bound(const Key &key) const {
+    return tree_.findUpperBound(key);
+  }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator upper_bound(const K &key) const {
+    return tree_.findUpperBound(key);
+  }
+
+  key_compare key_comp() const { return tree_.value_comp().get(); }
+
+  value_compare value_comp() const { return tree_.value_comp().get(); }
+
+  allocator_type get_allocator() const { return tree_.get_allocator(); }
+
+  // Every insertion may move earlier elements inside their node, so the
+  // returned iterators are looked up once all of them are in.
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::array<bool, sizeof...(Args)> inserted{insert(args).second...};
+    std::vector<std::pair<iterator, bool>> result;
+    result.reserve(sizeof...(args));
+    std::size_t i = 0;
+    (result.emplace_back(find(static_cast<const value_type &>(args)),
+                         inserted[i++]),
+     ...);
+    return result;
+  }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_BTREE_SET_H_
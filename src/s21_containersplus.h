@@ -2,6 +2,14 @@
 #define SRC_S21_CONTAINERSPLUS_H_
 
 #include "s21_array.h"
+#include "s21_btree_map.h"
+#include "s21_btree_set.h"
+#include "s21_intrusive_list.h"
+#include "s21_memory_resource.h"
+#include "s21_mmap_vector.h"
 #include "s21_multiset.h"
+#include "s21_small_vector.h"
+#include "s21_unordered_map.h"
+#include "s21_unordered_set.h"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
@@ -0,0 +1,559 @@
+#ifndef SRC_S21_HASH_TABLE_H_
+#define SRC_S21_HASH_TABLE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_utility.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Control byte of a slot: negative values are states, a full slot stores
+// 7 bits of its hash (H2).
+using ctrl_t = signed char;
+
+enum : ctrl_t { kCtrlEmpty = -128, kCtrlDeleted = -2 };
+
+// Bit i is set when control byte i of a group matched.
+class HashBitMask {
+ public:
+  explicit HashBitMask(std::uint32_t mask) : mask_(mask) {}
+
+  explicit operator bool() const noexcept { return mask_ != 0; }
+
+  unsigned lowest() const noexcept { return __builtin_ctz(mask_); }
+
+  // Zero bits above the highest match within a 16 byte group.
+  unsigned leadingZeros() const noexcept {
+    return __builtin_clz(mask_) - (32 - kWidth);
+  }
+
+  HashBitMask &operator++() noexcept {
+    mask_ &= mask_ - 1;
+    return *this;
+  }
+
+  static constexpr unsigned kWidth = 16;
+
+ private:
+  std::uint32_t mask_;
+};
+
+// Sixteen consecutive control bytes tested at once, with SSE2 when the
+// target has it and a scalar loop otherwise.
+class HashGroup {
+ public:
+  static constexpr std::size_t kWidth = HashBitMask::kWidth;
+
+#if defined(__SSE2__)
+  explicit HashGroup(const ctrl_t *pos)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+  HashBitMask match(ctrl_t h2) const noexcept {
+    return HashBitMask(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+  }
+
+  HashBitMask matchEmpty() const noexcept { return match(kCtrlEmpty); }
+
+  // Empty and deleted are the only states with the sign bit set.
+  HashBitMask matchEmptyOrDeleted() const noexcept {
+    return HashBitMask(_mm_movemask_epi8(ctrl_));
+  }
+
+ private:
+  __m128i ctrl_;
+#else
+  explicit HashGroup(const ctrl_t *pos) : ctrl_(pos) {}
+
+  HashBitMask match(ctrl_t h2) const noexcept {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kWidth; ++i) {
+      if (ctrl_[i] == h2) mask |= 1u << i;
+    }
+    return HashBitMask(mask);
+  }
+
+  HashBitMask matchEmpty() const noexcept { return match(kCtrlEmpty); }
+
+  HashBitMask matchEmptyOrDeleted() const noexcept {
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kWidth; ++i) {
+      if (ctrl_[i] < 0) mask |= 1u << i;
+    }
+    return HashBitMask(mask);
+  }
+
+ private:
+  const ctrl_t *ctrl_;
+#endif
+};
+
+// Spreads identity hashes such as std::hash<int> over all bits: the full
+// 128-bit Fibonacci product is folded (high ^ low), so that H1, taken from
+// the low bits, depends on the high bits of the key as well as H2 does.
+// Keys differing only in their high bits would share one probe start with
+// the low half of the product alone.
+inline std::uint64_t hashMix(std::uint64_t hash) noexcept {
+  constexpr std::uint64_t kMul = 0x9E3779B97F4A7C15ull;
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  uint128 product = static_cast<uint128>(hash) * kMul;
+  return static_cast<std::uint64_t>(product) ^
+         static_cast<std::uint64_t>(product >> 64);
+#else
+  std::uint64_t aLo = hash & 0xFFFFFFFFu;
+  std::uint64_t aHi = hash >> 32;
+  std::uint64_t bLo = kMul & 0xFFFFFFFFu;
+  std::uint64_t bHi = kMul >> 32;
+  std::uint64_t lolo = aLo * bLo;
+  std::uint64_t hilo = aHi * bLo;
+  std::uint64_t lohi = aLo * bHi;
+  std::uint64_t cross = (lolo >> 32) + (hilo & 0xFFFFFFFFu) + lohi;
+  std::uint64_t high = aHi * bHi + (hilo >> 32) + (cross >> 32);
+  return (hash * kMul) ^ high;
+#endif
+}
+
+// Open addressing hash table in the SwissTable layout: slots live in one
+// flat array, a parallel array of control bytes (kept in an s21::vector)
+// is probed a group at a time and only slots whose H2 matched are compared.
+// The first group of control bytes is cloned past the end so a group can be
+// loaded at any slot without wrapping. hash_ and equal_ must accept both
+// stored values and lookup keys.
+template <typename key_, typename value_, typename hash_, typename equal_,
+          typename Allocator = std::allocator<value_>>
+class HashTable {
+ public:
+  template <bool Const>
+  struct hashIterator;
+
+  using key_type = key_;
+  using value_type = value_;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = std::size_t;
+  using iterator = hashIterator<false>;
+  using const_iterator = hashIterator<true>;
+  using allocator_type = Allocator;
+
+  HashTable() = default;
+
+  explicit HashTable(const Allocator &alloc) : alloc_(alloc) {}
+
+  HashTable(size_type bucketCount, const hash_ &hash, const equal_ &equal,
+            const Allocator &alloc = Allocator())
+      : hasher_(hash), keyEqual_(equal), alloc_(alloc) {
+    reserve(bucketCount);
+  }
+
+  HashTable(const HashTable &other)
+      : hasher_(other.hasher_),
+        keyEqual_(other.keyEqual_),
+        alloc_(slot_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    copyFrom(other);
+  }
+
+  HashTable(HashTable &&other) noexcept
+      : hasher_(std::move(other.hasher_)),
+        keyEqual_(std::move(other.keyEqual_)),
+        alloc_(std::move(other.alloc_)) {
+    steal(other);
+  }
+
+  HashTable &operator=(const HashTable &other) {
+    if (this != &other) {
+      deleteTable();
+      hasher_ = other.hasher_;
+      keyEqual_ = other.keyEqual_;
+      if constexpr (slot_traits::propagate_on_container_copy_assignment::
+                        value) {
+        alloc_ = other.alloc_;
+      }
+      copyFrom(other);
+    }
+    return *this;
+  }
+
+  // Takes the slots of other when alloc_ can free them, moves the elements
+  // one by one into slots of its own otherwise.
+  HashTable &operator=(HashTable &&other) noexcept(
+      slot_traits::propagate_on_container_move_assignment::value ||
+      slot_traits::is_always_equal::value) {
+    if (this != &other) {
+      deleteTable();
+      hasher_ = std::move(other.hasher_);
+      keyEqual_ = std::move(other.keyEqual_);
+      if (slot_traits::propagate_on_container_move_assignment::value ||
+          alloc_ == other.alloc_) {
+        if constexpr (slot_traits::propagate_on_container_move_assignment::
+                          value) {
+          alloc_ = std::move(other.alloc_);
+        }
+        steal(other);
+      } else {
+        moveFrom(other);
+      }
+    }
+    return *this;
+  }
+
+  ~HashTable() { deleteTable(); }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / 2 /
+           (sizeof(value_type) + sizeof(ctrl_t));
+  }
+
+  iterator begin() noexcept { return iterator(ctrl_, slots_, capacity_, 0); }
+  iterator end() noexcept {
+    return iterator(ctrl_, slots_, capacity_, capacity_);
+  }
+  const_iterator begin() const noexcept {
+    return const_iterator(ctrl_, slots_, capacity_, 0);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(ctrl_, slots_, capacity_, capacity_);
+  }
+
+  // Inserts item unless an equal key is present. The bool tells whether the
+  // insertion took place; either way the iterator points at the key.
+  template <typename V>
+  std::pair<iterator, bool> insert(V &&item) {
+    return findOrEmplace(item, std::forward<V>(item));
+  }
+
+  // Looks key up and, on a miss, constructs the new element from args
+  // directly in the slot picked for it. Nothing is built on a hit.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> findOrEmplace(const K &key, Args &&...args) {
+    size_type hash = hashOf(key);
+    size_type index = findIndex(key, hash);
+    if (index != capacity_) return {iteratorAt(index), false};
+    index = prepareInsert(hash);
+    slot_traits::construct(alloc_, slots_ + index,
+                           std::forward<Args>(args)...);
+    setCtrl(index, h2(hash));
+    ++size_;
+    return {iteratorAt(index), true};
+  }
+
+  template <typename K>
+  iterator find(const K &key) {
+    return iteratorAt(findIndex(key, hashOf(key)));
+  }
+
+  template <typename K>
+  const_iterator find(const K &key) const {
+    size_type index = findIndex(key, hashOf(key));
+    return const_iterator(ctrl_, slots_, capacity_, index);
+  }
+
+  template <typename K>
+  bool contains(const K &key) const {
+    return findIndex(key, hashOf(key)) != capacity_;
+  }
+
+  void erase(const_iterator pos) { eraseIndex(pos.index_); }
+
+  template <typename K>
+  size_type eraseKey(const K &key) {
+    size_type index = findIndex(key, hashOf(key));
+    if (index == capacity_) return 0;
+    eraseIndex(index);
+    return 1;
+  }
+
+  void clear() noexcept {
+    destroySlots();
+    if (capacity_ > 0) {
+      std::fill(ctrlBytes_.begin(), ctrlBytes_.end(), kCtrlEmpty);
+    }
+    size_ = 0;
+    growthLeft_ = maxLoad(capacity_);
+  }
+
+  // Makes room for count elements without further rehashing.
+  void reserve(size_type count) {
+    if (count <= size_ + growthLeft_) return;
+    size_type capacity = HashGroup::kWidth;
+    while (maxLoad(capacity) < count) capacity *= 2;
+    rehash(capacity);
+  }
+
+  // Allocators are exchanged only when they propagate on swap; otherwise
+  // they must compare equal.
+  void swap(HashTable &other) noexcept {
+    std::swap(hasher_, other.hasher_);
+    std::swap(keyEqual_, other.keyEqual_);
+    if constexpr (slot_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    } else {
+      S21_CONTAINERS_ASSERT(alloc_ == other.alloc_,
+                            "swapping tables with unequal allocators");
+    }
+    ctrlBytes_.swap(other.ctrlBytes_);
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growthLeft_, other.growthLeft_);
+  }
+
+  const hash_ &hash_function() const noexcept { return hasher_; }
+  const equal_ &key_eq() const noexcept { return keyEqual_; }
+  allocator_type get_allocator() const { return alloc_; }
+
+  template <bool Const>
+  struct hashIterator {
+    using value_ptr =
+        std::conditional_t<Const, const value_type *, value_type *>;
+    using ref = std::conditional_t<Const, const_reference, reference>;
+
+    hashIterator() = default;
+    hashIterator(const ctrl_t *ctrl, value_ptr slots, size_type capacity,
+                 size_type index)
+        : ctrl_(ctrl), slots_(slots), capacity_(capacity), index_(index) {
+      skipEmpty();
+    }
+
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    hashIterator(const hashIterator<false> &other)
+        : ctrl_(other.ctrl_),
+          slots_(other.slots_),
+          capacity_(other.capacity_),
+          index_(other.index_) {}
+
+    ref operator*() const { return slots_[index_]; }
+    value_ptr operator->() const { return slots_ + index_; }
+
+    hashIterator &operator++() {
+      ++index_;
+      skipEmpty();
+      return *this;
+    }
+
+    hashIterator operator++(int) {
+      hashIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    bool operator==(const hashIterator &other) const noexcept {
+      return slots_ + index_ == other.slots_ + other.index_;
+    }
+
+    bool operator!=(const hashIterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+    void skipEmpty() noexcept {
+      while (index_ < capacity_ && ctrl_[index_] < 0) ++index_;
+    }
+
+    const ctrl_t *ctrl_ = nullptr;
+    value_ptr slots_ = nullptr;
+    size_type capacity_ = 0;
+    size_type index_ = 0;
+  };
+
+ private:
+  using slot_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<
+          value_type>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+
+  // At most 7/8 of the slots are ever full, so every probe sequence ends
+  // at an empty control byte.
+  static size_type maxLoad(size_type capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+
+  template <typename K>
+  size_type hashOf(const K &key) const {
+    return static_cast<size_type>(
+        hashMix(static_cast<std::uint64_t>(hasher_(key))));
+  }
+
+  static size_type h1(size_type hash) noexcept { return hash >> 7; }
+  static ctrl_t h2(size_type hash) noexcept {
+    return static_cast<ctrl_t>(hash >>
+                               (std::numeric_limits<size_type>::digits - 7));
+  }
+
+  iterator iteratorAt(size_type index) noexcept {
+    return iterator(ctrl_, slots_, capacity_, index);
+  }
+
+  // Index of the slot holding key, capacity_ when there is none.
+  template <typename K>
+  size_type findIndex(const K &key, size_type hash) const {
+    if (capacity_ == 0) return capacity_;
+    size_type mask = capacity_ - 1;
+    size_type pos = h1(hash) & mask;
+    ctrl_t tag = h2(hash);
+    for (size_type step = HashGroup::kWidth;; step += HashGroup::kWidth) {
+      HashGroup group(ctrl_ + pos);
+      for (HashBitMask match = group.match(tag); match; ++match) {
+        size_type index = (pos + match.lowest()) & mask;
+        if (keyEqual_(slots_[index], key)) return index;
+      }
+      if (group.matchEmpty()) return capacity_;
+      pos = (pos + step) & mask;
+    }
+  }
+
+  size_type findFirstNonFull(size_type hash) const noexcept {
+    size_type mask = capacity_ - 1;
+    size_type pos = h1(hash) & mask;
+    for (size_type step = HashGroup::kWidth;; step += HashGroup::kWidth) {
+      HashBitMask free = HashGroup(ctrl_ + pos).matchEmptyOrDeleted();
+      if (free) return (pos + free.lowest()) & mask;
+      pos = (pos + step) & mask;
+    }
+  }
+
+  // Picks the slot for a new element, growing or purging tombstones first
+  // when the empty slots have run out.
+  size_type prepareInsert(size_type hash) {
+    size_type index = capacity_ ? findFirstNonFull(hash) : 0;
+    if (capacity_ == 0 || (growthLeft_ == 0 && ctrl_[index] != kCtrlDeleted)) {
+      if (capacity_ == 0) {
+        rehash(HashGroup::kWidth);
+      } else if (size_ * 2 <= maxLoad(capacity_)) {
+        rehash(capacity_);
+      } else {
+        rehash(capacity_ * 2);
+      }
+      index = findFirstNonFull(hash);
+    }
+    if (ctrl_[index] == kCtrlEmpty) --growthLeft_;
+    return index;
+  }
+
+  void setCtrl(size_type index, ctrl_t value) noexcept {
+    ctrl_[index] = value;
+    if (index < HashGroup::kWidth) ctrl_[capacity_ + index] = value;
+  }
+
+  // A slot may go back to empty only if no probe sequence could have
+  // passed over it as part of a full group; otherwise it becomes a
+  // tombstone.
+  void eraseIndex(size_type index) {
+    slot_traits::destroy(alloc_, slots_ + index);
+    --size_;
+    size_type before = (index - HashGroup::kWidth) & (capacity_ - 1);
+    HashBitMask emptyAfter = HashGroup(ctrl_ + index).matchEmpty();
+    HashBitMask emptyBefore = HashGroup(ctrl_ + before).matchEmpty();
+    bool neverFull = emptyBefore && emptyAfter &&
+                     emptyAfter.lowest() + emptyBefore.leadingZeros() <
+                         HashGroup::kWidth;
+    setCtrl(index, neverFull ? kCtrlEmpty : kCtrlDeleted);
+    if (neverFull) ++growthLeft_;
+  }
+
+  void rehash(size_type capacity) {
+    HashTable fresh(alloc_);
+    fresh.allocate(capacity);
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (ctrl_[i] < 0) continue;
+      size_type hash = hashOf(slots_[i]);
+      size_type index = fresh.findFirstNonFull(hash);
+      slot_traits::construct(fresh.alloc_, fresh.slots_ + index,
+                             std::move_if_noexcept(slots_[i]));
+      fresh.setCtrl(index, h2(hash));
+    }
+    fresh.size_ = size_;
+    fresh.growthLeft_ = maxLoad(capacity) - size_;
+    fresh.hasher_ = std::move(hasher_);
+    fresh.keyEqual_ = std::move(keyEqual_);
+    swap(fresh);
+  }
+
+  void allocate(size_type capacity) {
+    slots_ = slot_traits::allocate(alloc_, capacity);
+    ctrlBytes_ = vector<ctrl_t>(capacity + HashGroup::kWidth);
+    std::fill(ctrlBytes_.begin(), ctrlBytes_.end(), kCtrlEmpty);
+    ctrl_ = ctrlBytes_.data();
+    capacity_ = capacity;
+    growthLeft_ = maxLoad(capacity);
+  }
+
+  void copyFrom(const HashTable &other) {
+    if (other.size_ == 0) return;
+    reserve(other.size_);
+    for (size_type i = 0; i < other.capacity_; ++i) {
+      if (other.ctrl_[i] >= 0) insert(other.slots_[i]);
+    }
+  }
+
+  void moveFrom(HashTable &other) {
+    if (other.size_ != 0) {
+      reserve(other.size_);
+      for (size_type i = 0; i < other.capacity_; ++i) {
+        if (other.ctrl_[i] >= 0) insert(std::move(other.slots_[i]));
+      }
+    }
+    other.deleteTable();
+  }
+
+  void destroySlots() noexcept {
+    if (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] >= 0) slot_traits::destroy(alloc_, slots_ + i);
+      }
+    }
+  }
+
+  void deleteTable() noexcept {
+    destroySlots();
+    if (slots_ != nullptr) slot_traits::deallocate(alloc_, slots_, capacity_);
+    ctrlBytes_ = vector<ctrl_t>();
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growthLeft_ = 0;
+  }
+
+  void steal(HashTable &other) noexcept {
+    ctrlBytes_ = std::move(other.ctrlBytes_);
+    ctrl_ = other.ctrl_;
+    slots_ = other.slots_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    growthLeft_ = other.growthLeft_;
+    other.ctrl_ = nullptr;
+    other.slots_ = nullptr;
+    other.capacity_ = 0;
+    other.size_ = 0;
+    other.growthLeft_ = 0;
+  }
+
+  hash_ hasher_;
+  equal_ keyEqual_;
+  slot_allocator alloc_;
+  vector<ctrl_t> ctrlBytes_;
+  ctrl_t *ctrl_ = nullptr;
+  value_type *slots_ = nullptr;
+  size_type capacity_ = 0;
+  size_type size_ = 0;
+  size_type growthLeft_ = 0;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_HASH_TABLE_H_
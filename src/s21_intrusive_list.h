@@ -0,0 +1,357 @@
+#ifndef SRC_S21_INTRUSIVE_LIST_H_
+#define SRC_S21_INTRUSIVE_LIST_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_utility.h"
+
+namespace s21 {
+class intrusive_list_hook;
+
+template <typename T, intrusive_list_hook T::*Member>
+class intrusive_list;
+
+// Links of one intrusive_list inside the object it lists. An object can
+// carry several hooks to be in several lists at once. Copying an object
+// does not copy its links: the copy starts out unlinked, and assignment
+// keeps the links of the target.
+class intrusive_list_hook {
+ public:
+  intrusive_list_hook() noexcept = default;
+  intrusive_list_hook(const intrusive_list_hook &) noexcept {}
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+    return *this;
+  }
+
+  // User-provided in every build, so that the hook, and every T holding
+  // one, has the same triviality whether or not the debug check is on.
+  ~intrusive_list_hook() {
+    S21_CONTAINERS_ASSERT(!is_linked(), "destroying a linked object");
+  }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  template <typename T, intrusive_list_hook T::*Member>
+  friend class intrusive_list;
+
+  intrusive_list_hook *prev_ = nullptr;
+  intrusive_list_hook *next_ = nullptr;
+};
+
+// Doubly linked list of objects that hold the links themselves, in the
+// intrusive_list_hook named by Member: s21::intrusive_list<T, &T::hook>.
+// Linking and unlinking never allocate, and erase(object) unlinks any
+// listed object in O(1) without a search or a stored iterator. The list
+// does not own its objects; they have to outlive their membership, and
+// clear() and the destructor only unlink them. An object is in at most one
+// list per hook; debug builds check that, and that no linked object is
+// destroyed.
+template <typename T, intrusive_list_hook T::*Member>
+class intrusive_list {
+  using Hook = intrusive_list_hook;
+
+ public:
+  class ListIterator;
+  class ListConstIterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = ListIterator;
+  using const_iterator = ListConstIterator;
+  using size_type = size_t;
+
+  intrusive_list() noexcept {
+    head_.prev_ = &head_;
+    head_.next_ = &head_;
+  }
+
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list &operator=(const intrusive_list &) = delete;
+
+  intrusive_list(intrusive_list &&other) noexcept : intrusive_list() {
+    swap(other);
+  }
+
+  intrusive_list &operator=(intrusive_list &&other) noexcept {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  ~intrusive_list() {
+    clear();
+    head_.prev_ = nullptr;
+    head_.next_ = nullptr;
+  }
+
+  class ListIterator final {
+   private:
+    friend intrusive_list;
+    Hook *ptr_;
+    ListIterator(Hook *ptr) noexcept : ptr_(ptr) {}
+
+   public:
+    ListIterator() noexcept : ptr_(nullptr) {}
+
+    reference operator*() const { return *ownerOf_(ptr_); }
+    T *operator->() const { return ownerOf_(ptr_); }
+
+    iterator &operator++() {
+      ptr_ = ptr_->next_;
+      return *this;
+    }
+
+    iterator operator++(int) {
+      iterator old = *this;
+      ptr_ = ptr_->next_;
+      return old;
+    }
+
+    iterator &operator--() {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+
+    iterator operator--(int) {
+      iterator old = *this;
+      ptr_ = ptr_->prev_;
+      return old;
+    }
+
+    bool operator==(const iterator &other) const {
+      return ptr_ == other.ptr_;
+    }
+
+    bool operator!=(const iterator &other) const {
+      return ptr_ != other.ptr_;
+    }
+  };
+
+  class ListConstIterator final {
+   private:
+    friend intrusive_list;
+    iterator c_ptr_;
+
+   public:
+    ListConstIterator() noexcept = default;
+    ListConstIterator(const iterator &other) noexcept : c_ptr_(other) {}
+
+    const_reference operator*() const { return *c_ptr_; }
+    const T *operator->() const { return c_ptr_.operator->(); }
+
+    const_iterator &operator++() {
+      ++c_ptr_;
+      return *this;
+    }
+
+    const_iterator operator++(int) { return c_ptr_++; }
+
+    const_iterator &operator--() {
+      --c_ptr_;
+      return *this;
+    }
+
+    const_iterator operator--(int) { return c_ptr_--; }
+
+    bool operator==(const const_iterator &other) const {
+      return c_ptr_ == other.c_ptr_;
+    }
+
+    bool operator!=(const const_iterator &other) const {
+      return c_ptr_ != other.c_ptr_;
+    }
+  };
+
+  iterator begin() noexcept { return iterator(head_.next_); }
+  iterator end() noexcept { return iterator(&head_); }
+  const_iterator begin() const noexcept { return iterator(head_.next_); }
+  const_iterator end() const noexcept { return iterator(sentinel_()); }
+
+  // Iterator to an object listed here, found through its hook in O(1).
+  iterator iterator_to(reference object) noexcept {
+    S21_CONTAINERS_ASSERT((object.*Member).is_linked(),
+                          "iterator_to an unlinked object");
+    return iterator(&(object.*Member));
+  }
+
+  const_iterator iterator_to(const_reference object) const noexcept {
+    return iterator(const_cast<Hook *>(&(object.*Member)));
+  }
+
+  bool empty() const noexcept { return size_ == 0; }
+  size_type size() const noexcept { return size_; }
+
+  reference front() {
+    checkNotEmpty_();
+    return *ownerOf_(head_.next_);
+  }
+
+  const_reference front() const {
+    checkNotEmpty_();
+    return *ownerOf_(head_.next_);
+  }
+
+  reference back() {
+    checkNotEmpty_();
+    return *ownerOf_(head_.prev_);
+  }
+
+  const_reference back() const {
+    checkNotEmpty_();
+    return *ownerOf_(head_.prev_);
+  }
+
+  void push_back(reference object) noexcept { insert(end(), object); }
+  void push_front(reference object) noexcept { insert(begin(), object); }
+
+  void pop_back() {
+    checkNotEmpty_();
+    unlink_(head_.prev_);
+  }
+
+  void pop_front() {
+    checkNotEmpty_();
+    unlink_(head_.next_);
+  }
+
+  // Links object before pos. It must not be in a list through this hook.
+  iterator insert(const_iterator pos, reference object) noexcept {
+    Hook *hook = &(object.*Member);
+    S21_CONTAINERS_ASSERT(!hook->is_linked(), "object is already linked");
+    recordHookOffset_(object);
+    Hook *next = pos.c_ptr_.ptr_;
+    hook->next_ = next;
+    hook->prev_ = next->prev_;
+    next->prev_->next_ = hook;
+    next->prev_ = hook;
+    ++size_;
+    return iterator(hook);
+  }
+
+  // Unlinks the object at pos and returns the iterator after it.
+  iterator erase(const_iterator pos) {
+    Hook *hook = pos.c_ptr_.ptr_;
+    if (hook == &head_) {
+      throw std::out_of_range("Cannot erase the end of an intrusive_list");
+    }
+    Hook *next = hook->next_;
+    unlink_(hook);
+    return iterator(next);
+  }
+
+  // Unlinks object, which must be listed here, in O(1).
+  void erase(reference object) noexcept {
+    S21_CONTAINERS_ASSERT((object.*Member).is_linked(),
+                          "erasing an unlinked object");
+    unlink_(&(object.*Member));
+  }
+
+  // Unlinks every object; the objects themselves are left alone.
+  void clear() noexcept {
+    Hook *hook = head_.next_;
+    while (hook != &head_) {
+      Hook *next = hook->next_;
+      hook->prev_ = nullptr;
+      hook->next_ = nullptr;
+      hook = next;
+    }
+    head_.next_ = &head_;
+    head_.prev_ = &head_;
+    size_ = 0;
+  }
+
+  // Moves every object of other before pos in O(1).
+  void splice(const_iterator pos, intrusive_list &other) noexcept {
+    if (this == &other || other.empty()) return;
+    Hook *next = pos.c_ptr_.ptr_;
+    Hook *first = other.head_.next_;
+    Hook *last = other.head_.prev_;
+    first->prev_ = next->prev_;
+    last->next_ = next;
+    next->prev_->next_ = first;
+    next->prev_ = last;
+    size_ += other.size_;
+    other.head_.next_ = &other.head_;
+    other.head_.prev_ = &other.head_;
+    other.size_ = 0;
+  }
+
+  void swap(intrusive_list &other) noexcept {
+    std::swap(head_.prev_, other.head_.prev_);
+    std::swap(head_.next_, other.head_.next_);
+    std::swap(size_, other.size_);
+    relinkSentinel_();
+    other.relinkSentinel_();
+  }
+
+ private:
+  // Offset of the hook inside T, measured on the first object linked by a
+  // list of this type. Every hook handed to ownerOf_ was linked by insert()
+  // first, so the offset is known by then. A T::* member pointer cannot
+  // name a member of a virtual base, so the offset is the same in every T.
+  static inline std::atomic<std::ptrdiff_t> hookOffset_{-1};
+
+  static void recordHookOffset_(reference object) noexcept {
+    std::ptrdiff_t offset =
+        reinterpret_cast<unsigned char *>(&(object.*Member)) -
+        reinterpret_cast<unsigned char *>(std::addressof(object));
+    if (hookOffset_.load(std::memory_order_relaxed) < 0) {
+      hookOffset_.store(offset, std::memory_order_relaxed);
+    }
+    S21_CONTAINERS_ASSERT(
+        hookOffset_.load(std::memory_order_relaxed) == offset,
+        "hook offset differs between objects");
+  }
+
+  static T *ownerOf_(Hook *hook) noexcept {
+    return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) -
+                                 hookOffset_.load(std::memory_order_relaxed));
+  }
+
+  static const T *ownerOf_(const Hook *hook) noexcept {
+    return ownerOf_(const_cast<Hook *>(hook));
+  }
+
+  // The sentinel is only ever linked to, never dereferenced as a T.
+  Hook *sentinel_() const noexcept { return const_cast<Hook *>(&head_); }
+
+  void checkNotEmpty_() const {
+    if (size_ == 0) {
+      throw std::out_of_range("Empty intrusive_list has no elements");
+    }
+  }
+
+  void unlink_(Hook *hook) noexcept {
+    hook->prev_->next_ = hook->next_;
+    hook->next_->prev_ = hook->prev_;
+    hook->prev_ = nullptr;
+    hook->next_ = nullptr;
+    --size_;
+  }
+
+  // Points the neighbours of the sentinel back at it after its links were
+  // exchanged with another list.
+  void relinkSentinel_() noexcept {
+    if (size_ == 0) {
+      head_.next_ = &head_;
+      head_.prev_ = &head_;
+    } else {
+      head_.next_->prev_ = &head_;
+      head_.prev_->next_ = &head_;
+    }
+  }
+
+  Hook head_;
+  size_type size_ = 0;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_INTRUSIVE_LIST_H_
@@ -1,13 +1,30 @@
 #ifndef SRC_S21_LIST_H_
 #define SRC_S21_LIST_H_
 
+#include <functional>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <utility>
+
+#include "s21_utility.h"
 
 namespace s21 {
-template <typename T>
-class list {
+// Doubly linked list closed into a ring by one sentinel embedded in the
+// list object. The sentinel holds links but no value, so an empty list
+// allocates nothing and T needs no default constructor; end() and
+// --begin() both are the sentinel, and moving or swapping lists relinks it
+// and invalidates their end() iterators. Nodes come from Allocator rebound
+// to the node type, one per element; for pooled nodes use s21::pmr::list
+// over a pool_resource, per list or shared by lists that splice into each
+// other. Elements are placement-constructed like in s21::vector.
+template <typename T, typename Allocator = std::allocator<T>>
+class list : private EboStorage<Allocator> {
+  using alloc_traits = std::allocator_traits<Allocator>;
+
  public:
   class ListIterator;
   class ListConstIterator;
@@ -18,67 +35,88 @@ class list {
   using iterator = ListIterator;
   using const_iterator = ListConstIterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
  private:
+  struct NodeBase;
   struct Node;
 
  public:
-  list() : head_(new Node()), tail_(new Node()) {
-    head_->next_ = tail_;
-    head_->prev_ = tail_;
-    tail_->next_ = head_;
-    tail_->prev_ = head_;
-  }
+  list() noexcept(noexcept(Allocator())) : list(Allocator()) {}
+
+  explicit list(const Allocator& alloc) noexcept
+      : EboStorage<Allocator>(alloc) {}
 
-  list(size_type n) : list() {
+  list(size_type n, const Allocator& alloc = Allocator()) : list(alloc) {
     if (n >= max_size() - 1) {
       throw std::invalid_argument(
           "The size of the list exceeds the memory limit or the number of "
           "elements is smaller than zero.");
     }
-    for (size_type i = 0; i < n; ++i) {
-      const_reference v{};
-      push_front(v);
-    }
+    for (size_type i = 0; i < n; ++i) emplace_back();
   }
 
-  list(std::initializer_list<value_type> const& items) : list() {
+  list(std::initializer_list<value_type> const& items,
+       const Allocator& alloc = Allocator())
+      : list(alloc) {
     for (auto const& i : items) push_back(i);
   }
 
-  list(list const& l) : list() {
-    Node* element = l.head_->next_;
-    while (element != l.tail_) {
-      push_back(element->data_);
-      element = element->next_;
-    }
+  list(list const& l)
+      : list(l, alloc_traits::select_on_container_copy_construction(
+                    l.alloc_())) {}
+
+  list(list const& l, const Allocator& alloc) : list(alloc) {
+    for (auto const& i : l) push_back(i);
   }
 
   list& operator=(list const& l) {
     if (this != &l) {
       clear();
-      Node* element = l.head_->next_;
-      while (element != l.tail_) {
-        push_back(element->data_);
-        element = element->next_;
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        alloc_() = l.alloc_();
       }
+      for (auto const& i : l) push_back(i);
     }
     return *this;
   }
 
-  list(list&& l) noexcept : list() { swap(l); }
+  list(list&& l) noexcept : list(l.alloc_()) { stealFrom_(l); }
 
-  list& operator=(list&& l) noexcept {
-    if (this != &l) swap(l);
-    return *this;
+  // Takes the nodes of l when alloc can free them, moves the elements one
+  // by one into new nodes otherwise.
+  list(list&& l, const Allocator& alloc) : list(alloc) {
+    if (alloc_() == l.alloc_()) {
+      stealFrom_(l);
+    } else {
+      moveElementsFrom_(l);
+    }
   }
 
-  ~list() {
-    clear();
-    delete head_;
-    delete tail_;
+  list& operator=(list&& l) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &l) {
+      clear();
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          alloc_() == l.alloc_()) {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                          value) {
+          alloc_() = l.alloc_();
+        }
+        stealFrom_(l);
+      } else {
+        moveElementsFrom_(l);
+      }
+    }
+    return *this;
   }
 
+  ~list() { clear(); }
+
+  allocator_type get_allocator() const noexcept { return alloc_(); }
+
   size_type max_size() const noexcept {
     return std::numeric_limits<size_type>::max() / (sizeof(Node));
   }
@@ -86,8 +124,8 @@ class list {
   class ListIterator final {
    private:
     friend list;
-    Node* ptr_;
-    ListIterator(Node* ptr) noexcept : ptr_(ptr){};
+    NodeBase* ptr_;
+    ListIterator(NodeBase* ptr) noexcept : ptr_(ptr){};
 
    public:
     ListIterator() : ptr_(nullptr){};
@@ -97,7 +135,7 @@ class list {
     iterator& operator=(iterator const& other) = default;
     iterator& operator=(iterator&& other) = default;
 
-    value_type& operator*() const { return ptr_->data_; }
+    value_type& operator*() const { return valueOf_(ptr_); }
 
     iterator& operator++() {
       ptr_ = ptr_->next_;
@@ -180,219 +218,394 @@ class list {
     }
   };
 
-  const_reference front() const { return head_->next_->data_; }
-  const_reference back() const { return tail_->prev_->data_; }
+  const_reference front() const { return valueOf_(head_.next_); }
+  const_reference back() const { return valueOf_(head_.prev_); }
   bool empty() const { return list_size_ ? false : true; };
   size_type size() const { return list_size_; }
-  iterator begin() { return iterator(head_->next_); }
-  iterator end() { return iterator(tail_); }
-  const_iterator begin() const { return const_iterator(head_->next_); }
-  const_iterator end() const { return const_iterator(tail_); }
-  void push_back(const_reference value) { insert(end(), value); }
-  void push_front(const_reference value) { insert(begin(), value); }
+  iterator begin() { return iterator(head_.next_); }
+  iterator end() { return iterator(&head_); }
+  const_iterator begin() const { return iterator(head_.next_); }
+  const_iterator end() const { return iterator(sentinel_()); }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type&& value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type&& value) { emplace_front(std::move(value)); }
   void pop_back() { erase(--end()); }
   void pop_front() { erase(begin()); }
 
+  // Allocators are exchanged only when they propagate on swap; otherwise
+  // they must compare equal.
   void swap(list& other) noexcept {
-    Node* temp_head = other.head_;
-    Node* temp_tail = other.tail_;
-    size_type temp_size = other.list_size_;
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_(), other.alloc_());
+    }
+    std::swap(head_, other.head_);
+    std::swap(list_size_, other.list_size_);
+    relinkSentinel_();
+    other.relinkSentinel_();
+  }
 
-    other.head_ = head_;
-    other.tail_ = tail_;
-    other.list_size_ = list_size_;
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
 
-    head_ = temp_head;
-    tail_ = temp_tail;
-    list_size_ = temp_size;
+  iterator insert(iterator pos, value_type&& value) {
+    return emplace(pos, std::move(value));
   }
 
-  iterator insert(iterator pos, const_reference value) {
-    Node* new_elem = new Node();
-    Node* old_elem = pos.ptr_;
-    new_elem->data_ = value;
-    new_elem->next_ = old_elem;
-    new_elem->prev_ = old_elem->prev_;
-    new_elem->prev_->next_ = new_elem;
-    old_elem->prev_ = new_elem;
-    ++list_size_;
-    iterator pos_new(new_elem);
-    return pos_new;
+  // Constructs the element from args directly inside its new node.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    return iterator(linkBefore_(pos.c_ptr_.ptr_,
+                                createNode_(std::forward<Args>(args)...)));
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  reference emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
   }
 
   void reverse() {
-    if (size() > 1) {
-      Node* element = tail_->prev_;
-      while (element != head_) {
-        Node* temp = element->prev_;
-        element->prev_ = element->next_;
-        element->next_ = temp;
-        element = element->next_;
-      }
-      Node* temp = head_->next_;
-      head_->next_ = tail_->prev_;
-      tail_->prev_ = temp;
-      head_->prev_ = tail_;
-      tail_->next_ = head_;
-      head_->next_->prev_ = head_;
-      tail_->prev_->next_ = tail_;
-    }
+    NodeBase* node = &head_;
+    do {
+      std::swap(node->prev_, node->next_);
+      node = node->prev_;
+    } while (node != &head_);
   }
 
   void unique() {
     if (size() > 1) {
-      Node* first = head_->next_;
-      Node* second = first;
-      while (second != tail_) {
-        second = first->next_;
-        while (first->data_ == second->data_ && second != tail_) {
+      NodeBase* first = head_.next_;
+      NodeBase* second = first->next_;
+      while (second != &head_) {
+        if (valueOf_(first) == valueOf_(second)) {
           erase(second);
-          second = first->next_;
+        } else {
+          first = second;
         }
-        first = first->next_;
+        second = first->next_;
       }
     }
   }
 
+  // The splice overloads relink nodes of other before pos without
+  // allocating or touching the elements. Iterators to the moved elements
+  // stay valid and now refer into this list.
   void splice(const_iterator pos, list& other) {
-    if (!other.empty() && begin() != other.begin()) {
-      Node* temp_second = other.head_;
-      Node* temp_first = pos.c_ptr_.ptr_;
-      while (other.list_size_) {
-        temp_second = other.head_->next_;
-        other.head_->next_->next_->prev_ = other.head_;
-        other.head_->next_ = other.head_->next_->next_;
-        temp_second->next_ = temp_first;
-        temp_second->prev_ = temp_first->prev_;
-        temp_second->prev_->next_ = temp_second;
-        temp_first->prev_ = temp_second;
-        --other.list_size_;
-        ++list_size_;
-      }
+    if (this == &other || other.empty()) return;
+    transfer_(pos.c_ptr_.ptr_, other.head_.next_, &other.head_);
+    list_size_ += other.list_size_;
+    other.list_size_ = 0;
+  }
+
+  void splice(const_iterator pos, list& other, const_iterator it) {
+    NodeBase* node = it.c_ptr_.ptr_;
+    NodeBase* before = pos.c_ptr_.ptr_;
+    if (node == before || node->next_ == before) return;
+    transfer_(before, node, node->next_);
+    --other.list_size_;
+    ++list_size_;
+  }
+
+  // Moves [first, last). Linear in the length of the range when other is
+  // a different list, to keep both sizes, and O(1) within one list.
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last) {
+    NodeBase* from = first.c_ptr_.ptr_;
+    NodeBase* to = last.c_ptr_.ptr_;
+    if (from == to) return;
+    if (this != &other) {
+      size_type count = 0;
+      for (NodeBase* node = from; node != to; node = node->next_) ++count;
+      other.list_size_ -= count;
+      list_size_ += count;
     }
+    transfer_(pos.c_ptr_.ptr_, from, to);
   }
 
-  void sort() {
-    if (size() > 1) {
-      Node* element_fisrt = head_->next_;
-      Node* element_second = head_->next_->next_;
-      while (element_fisrt != tail_->prev_) {
-        Node* dummy = element_fisrt;
-        Node* min = element_fisrt;
-        while (element_second != tail_) {
-          if (dummy->data_ > element_second->data_) {
-            min = element_second;
-          }
-          element_second = element_second->next_;
+  void sort() { sort(std::less<>()); }
+
+  // Stable merge sort that relinks nodes instead of moving values. Sorted
+  // runs of 1, 2, 4, ... nodes wait in bins like the digits of a binary
+  // counter and each new node carries into them, so the sort is bottom-up,
+  // O(n log n) in comparisons and allocates nothing. If comp throws, the
+  // list keeps all of its elements in an unspecified order.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size() < 2) return;
+    NodeBase* bins[std::numeric_limits<size_type>::digits] = {};
+    size_type used = 0;
+    NodeBase* rest = takeChain_();
+    NodeBase* run = nullptr;
+    try {
+      while (rest != nullptr) {
+        run = rest;
+        rest = rest->next_;
+        run->next_ = nullptr;
+        size_type i = 0;
+        for (; i < used && bins[i] != nullptr; ++i) {
+          NodeBase* later = run;
+          run = bins[i];
+          bins[i] = nullptr;
+          mergeChains_(run, later, comp);
         }
-        if (dummy != min) {
-          if (dummy->next_ == min) {
-            min->prev_ = min->prev_->prev_;
-            dummy->next_ = dummy->next_->next_;
-            dummy->prev_ = min;
-            min->next_ = dummy;
-          } else {
-            Node* temp_next = dummy->next_;
-            dummy->next_ = min->next_;
-            min->next_ = temp_next;
-
-            Node* temp_prev = dummy->prev_;
-            dummy->prev_ = min->prev_;
-            min->prev_ = temp_prev;
-
-            min->next_->prev_ = min;
-            dummy->prev_->next_ = dummy;
-          }
-          min->prev_->next_ = min;
-          dummy->next_->prev_ = dummy;
-          element_fisrt = min;
+        bins[i] = run;
+        run = nullptr;
+        if (i == used) ++used;
+      }
+      for (size_type i = 1; i < used; ++i) {
+        NodeBase* later = bins[i - 1];
+        bins[i - 1] = nullptr;
+        if (bins[i] == nullptr) {
+          bins[i] = later;
         } else {
-          element_fisrt = element_fisrt->next_;
+          mergeChains_(bins[i], later, comp);
         }
-        element_second = element_fisrt->next_;
       }
+    } catch (...) {
+      for (size_type i = 0; i < used; ++i) rest = joinChains_(bins[i], rest);
+      linkChain_(joinChains_(run, rest));
+      throw;
     }
+    linkChain_(bins[used - 1]);
   }
 
-  void merge(list& other) {
-    if (this != &other && !other.empty()) {
-      if (empty()) {
-        *this = std::move(other);
-      } else {
-        Node* temp_first = head_->next_;
-        while (other.head_->next_ != other.tail_) {
-          if ((temp_first->data_ <= other.head_->next_->data_ ||
-               other.head_->next_ == other.tail_) &&
-              temp_first != tail_) {
-            temp_first = temp_first->next_;
-          } else if (temp_first->data_ > other.head_->next_->data_ ||
-                     temp_first == tail_) {
-            Node* temp_second = other.head_->next_;
-            other.head_->next_->next_->prev_ = other.head_;
-            other.head_->next_ = other.head_->next_->next_;
-            temp_second->next_ = temp_first;
-            temp_second->prev_ = temp_first->prev_;
-            temp_second->prev_->next_ = temp_second;
-            temp_first->prev_ = temp_second;
-            --other.list_size_;
-            ++list_size_;
-          }
-        }
-      }
+  void merge(list& other) { merge(other, std::less<>()); }
+
+  // Merges the sorted other into this sorted list by relinking its nodes,
+  // leaving other empty. Stable: of equal elements, those of this list come
+  // first. If comp throws, every element ends up in this list.
+  template <typename Compare>
+  void merge(list& other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    list_size_ += other.list_size_;
+    other.list_size_ = 0;
+    NodeBase* chain = takeChain_();
+    NodeBase* other_chain = other.takeChain_();
+    try {
+      mergeChains_(chain, other_chain, comp);
+    } catch (...) {
+      linkChain_(chain);
+      throw;
     }
+    linkChain_(chain);
   }
 
   void erase(iterator pos) {
-    if (pos == --begin() || pos == end() || size() == 0) {
+    if (pos == end() || size() == 0) {
       throw std::out_of_range(
           "Invalid pointer: cannot be erased or dereferenced.");
     }
-    Node* element = pos.ptr_;
+    NodeBase* element = pos.ptr_;
     element->next_->prev_ = element->prev_;
     element->prev_->next_ = element->next_;
-    delete element;
-    pos.ptr_ = nullptr;
+    destroyNode_(static_cast<Node*>(element));
     --list_size_;
   }
 
   void clear() {
-    Node* element = head_->next_;
-    while (element != tail_) {
-      pop_front();
-      element = head_->next_;
+    NodeBase* element = head_.next_;
+    while (element != &head_) {
+      NodeBase* next = element->next_;
+      destroyNode_(static_cast<Node*>(element));
+      element = next;
     }
+    head_.next_ = &head_;
+    head_.prev_ = &head_;
+    list_size_ = 0;
   }
 
+  // Emplaces one element per argument before pos, in order, so each is
+  // constructed once from what was passed.
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args) {
-    std::initializer_list<value_type> items = {std::forward<Args>(args)...};
-    for (auto const& i : items) {
-      insert(pos.c_ptr_, i);
-    }
+    (emplace(pos, std::forward<Args>(args)), ...);
     return pos.c_ptr_;
   }
 
   template <typename... Args>
   void insert_many_front(Args&&... args) {
-    insert_many(begin(), args...);
+    insert_many(begin(), std::forward<Args>(args)...);
   }
 
   template <typename... Args>
   void insert_many_back(Args&&... args) {
-    insert_many(end(), args...);
+    insert_many(end(), std::forward<Args>(args)...);
   }
 
  private:
-  struct Node {
-    value_type data_;
-    Node* prev_ = nullptr;
-    Node* next_ = nullptr;
+  using node_allocator = typename alloc_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  struct NodeBase {
+    NodeBase* prev_;
+    NodeBase* next_;
+  };
+
+  // The value lives in raw storage so that a node can be allocated before
+  // its element is constructed.
+  struct Node : NodeBase {
+    alignas(value_type) unsigned char data_[sizeof(value_type)];
+
+    value_type* value() noexcept {
+      return std::launder(reinterpret_cast<value_type*>(data_));
+    }
   };
 
-  Node* head_;
-  Node* tail_;
+  static value_type& valueOf_(NodeBase* node) noexcept {
+    return *static_cast<Node*>(node)->value();
+  }
+
+  Allocator& alloc_() noexcept { return this->get(); }
+  const Allocator& alloc_() const noexcept { return this->get(); }
+
+  // The sentinel only ever has its links written through, never its value,
+  // so handing it out from const members is safe.
+  NodeBase* sentinel_() const noexcept {
+    return const_cast<NodeBase*>(&head_);
+  }
+
+  template <typename... Args>
+  Node* createNode_(Args&&... args) {
+    node_allocator alloc(alloc_());
+    Node* node = ::new (static_cast<void*>(node_traits::allocate(alloc, 1)))
+        Node;
+    try {
+      ::new (static_cast<void*>(node->data_))
+          value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(alloc, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode_(Node* node) noexcept {
+    std::destroy_at(node->value());
+    node_allocator alloc(alloc_());
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  NodeBase* linkBefore_(NodeBase* pos, NodeBase* node) noexcept {
+    node->next_ = pos;
+    node->prev_ = pos->prev_;
+    pos->prev_->next_ = node;
+    pos->prev_ = node;
+    ++list_size_;
+    return node;
+  }
+
+  // Points the neighbours of the sentinel back at it after its links were
+  // copied in from another list.
+  void relinkSentinel_() noexcept {
+    if (list_size_ == 0) {
+      head_.next_ = &head_;
+      head_.prev_ = &head_;
+    } else {
+      head_.next_->prev_ = &head_;
+      head_.prev_->next_ = &head_;
+    }
+  }
+
+  void stealFrom_(list& l) noexcept {
+    head_ = l.head_;
+    list_size_ = l.list_size_;
+    relinkSentinel_();
+    l.list_size_ = 0;
+    l.relinkSentinel_();
+  }
+
+  void moveElementsFrom_(list& l) {
+    for (auto& i : l) emplace_back(std::move(i));
+    l.clear();
+  }
+
+  // Relinks the nodes of [first, last) before pos, in O(1). pos must not
+  // be inside the range.
+  static void transfer_(NodeBase* pos, NodeBase* first,
+                        NodeBase* last) noexcept {
+    if (pos == last) return;
+    NodeBase* tail = last->prev_;
+    first->prev_->next_ = last;
+    last->prev_ = first->prev_;
+    first->prev_ = pos->prev_;
+    tail->next_ = pos;
+    pos->prev_->next_ = first;
+    pos->prev_ = tail;
+  }
+
+  // Unlinks all nodes from the sentinel and returns them as a chain linked
+  // through next_ and ended by nullptr. The size is left unchanged.
+  NodeBase* takeChain_() noexcept {
+    if (head_.next_ == &head_) return nullptr;
+    NodeBase* first = head_.next_;
+    head_.prev_->next_ = nullptr;
+    head_.next_ = &head_;
+    head_.prev_ = &head_;
+    return first;
+  }
+
+  // Links a chain to the sentinel of a list emptied by takeChain_,
+  // restoring the prev_ pointers.
+  void linkChain_(NodeBase* chain) noexcept {
+    NodeBase* prev = &head_;
+    for (; chain != nullptr; chain = chain->next_) {
+      chain->prev_ = prev;
+      prev->next_ = chain;
+      prev = chain;
+    }
+    prev->next_ = &head_;
+    head_.prev_ = prev;
+  }
+
+  static NodeBase* joinChains_(NodeBase* first, NodeBase* second) noexcept {
+    if (first == nullptr) return second;
+    NodeBase* last = first;
+    while (last->next_ != nullptr) last = last->next_;
+    last->next_ = second;
+    return first;
+  }
+
+  // Merges the sorted chain from into the sorted chain into, taking a node
+  // of from only when it is less than the next one of into, which keeps
+  // the merge stable. If comp throws, into still holds every node.
+  template <typename Compare>
+  static void mergeChains_(NodeBase*& into, NodeBase* from, Compare& comp) {
+    NodeBase* a = into;
+    NodeBase** link = &into;
+    try {
+      while (a != nullptr && from != nullptr) {
+        if (comp(valueOf_(from), valueOf_(a))) {
+          *link = from;
+          from = from->next_;
+        } else {
+          *link = a;
+          a = a->next_;
+        }
+        link = &(*link)->next_;
+      }
+    } catch (...) {
+      *link = joinChains_(a, from);
+      throw;
+    }
+    *link = a != nullptr ? a : from;
+  }
+
+  NodeBase head_{&head_, &head_};
   size_type list_size_ = 0;
 };
+
+namespace pmr {
+// List whose nodes come from a std::pmr::memory_resource, e.g. an
+// s21::pmr::pool_resource that recycles them through its free lists.
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // SRC_S21_LIST_H_
@@ -1,10 +1,13 @@
 #ifndef S21_CONTAINERS_MAP_H
 #define S21_CONTAINERS_MAP_H
 
+#include <tuple>
+
 #include "s21_binary_tree.h"
 
 namespace s21 {
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
 class map {
  public:
   using key_type = Key;
@@ -13,31 +16,62 @@ class map {
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = std::size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  // Orders stored pairs by key and pairs against bare keys, always through
+  // the user supplied Compare.
+  struct mapCompare : EboStorage<Compare> {
+    using is_transparent = void;
+
+    mapCompare() = default;
+    explicit mapCompare(const Compare& comp) : EboStorage<Compare>(comp) {}
+
+    bool operator()(const value_type& a, const value_type& b) const {
+      return this->get()(a.first, b.first);
+    }
+
+    template <typename K>
+    bool operator()(const value_type& a, const K& b) const {
+      return this->get()(a.first, b);
+    }
 
-  struct mapCompare {
-    bool operator()(const value_type& a, const value_type& b) const noexcept {
-      return a.first < b.first;
+    template <typename K>
+    bool operator()(const K& a, const value_type& b) const {
+      return this->get()(a, b.first);
     }
   };
 
-  using iterator =
-      typename BinaryTree<key_type, value_type, mapCompare>::iterator;
-  using const_iterator =
-      typename BinaryTree<key_type, value_type, mapCompare>::const_iterator;
-  using Node = typename BinaryTree<key_type, value_type, mapCompare>::Node;
+  // Orders stored pairs by key, like std::map::value_compare.
+  using value_compare = mapCompare;
 
-  map() : tree(new BinaryTree<key_type, value_type, mapCompare>) {}
+  using tree_type =
+      BinaryTree<key_type, value_type, mapCompare, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using Node = typename tree_type::Node;
 
-  map(std::initializer_list<value_type> const& items)
-      : tree(new BinaryTree<key_type, value_type, mapCompare>()) {
-    for (auto item : items) {
-      insert(item);
-    }
+  map() : tree(new tree_type) {}
+
+  explicit map(const Allocator& alloc) : tree(new tree_type(alloc)) {}
+
+  explicit map(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree(new tree_type(mapCompare(comp), alloc)) {}
+
+  map(std::initializer_list<value_type> const& items) : tree(new tree_type) {
+    tree->assignSorted(items.begin(), items.end(), true);
+  }
+
+  // Builds a perfectly balanced tree in O(n) from sorted input, unsorted
+  // input is sorted first.
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  map(InputIt first, InputIt last) : tree(new tree_type) {
+    tree->assignSorted(first, last, true);
   }
 
-  map(const map& m) : tree(new BinaryTree(*m.tree)) {}
+  map(const map& m) : tree(new tree_type(*m.tree)) {}
 
-  map(map&& m) : tree(new BinaryTree(std::move(*m.tree))) {}
+  map(map&& m) : tree(new tree_type(std::move(*m.tree))) {}
 
   map& operator=(map& m) {
     *tree = *m.tree;
@@ -57,7 +91,18 @@ class map {
 
   T& at(const Key& key) { return (*tree->at(key)).second; }
 
-  T& operator[](const Key& key) { return at(key); }
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  T& at(const K& key) { return (*tree->at(key)).second; }
+
+  // Returns the mapped value of key, value-initialising a new one in place
+  // only when key is missing.
+  T& operator[](const Key& key) {
+    return (*tree->findOrEmplace(key, std::piecewise_construct,
+                                 std::forward_as_tuple(key),
+                                 std::forward_as_tuple())
+                 .first)
+        .second;
+  }
 
   iterator begin() { return iterator(tree->minNode(), tree->getRoot()); }
 
@@ -79,7 +124,7 @@ class map {
     return (std::numeric_limits<size_type>::max() / 2) / sizeof(Node);
   }
 
-  std::pair<iterator, bool> insert(const reference value) {
+  std::pair<iterator, bool> insert(const_reference value) {
     return tree->insertUnique(value);
   }
 
@@ -96,12 +141,25 @@ class map {
     return result;
   }
 
+  allocator_type get_allocator() const { return tree->get_allocator(); }
+
+  key_compare key_comp() const { return tree->value_comp().get(); }
+
+  value_compare value_comp() const { return tree->value_comp(); }
+
   void erase(iterator pos) { tree->erase(pos); }
 
   void swap(map& other) { std::swap(tree, other.tree); }
 
   void clear() { tree->clearTree(); }
 
+  // Replaces the contents with [first, last) in O(n) when the range is
+  // sorted, in O(n log n) otherwise.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree->assignSorted(first, last, true);
+  }
+
   void merge(map& other) {
     auto otherEnd = other.end();
     for (auto it = other.begin(); it != otherEnd; ++it) {
@@ -112,6 +170,36 @@ class map {
 
   bool contains(const Key& key) { return tree->containsPair(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  bool contains(const K& key) { return tree->containsPair(key); }
+
+  iterator find(const Key& key) { return tree->find(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator find(const K& key) { return tree->find(key); }
+
+  size_type count(const Key& key) { return contains(key) ? 1 : 0; }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  size_type count(const K& key) { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key& key) { return tree->findLowerBound(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator lower_bound(const K& key) { return tree->findLowerBound(key); }
+
+  iterator upper_bound(const Key& key) { return tree->findUpperBound(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator upper_bound(const K& key) { return tree->findUpperBound(key); }
+
+  iterator nth_element(size_type k) { return tree->nth(k); }
+
+  size_type rank(const Key& key) { return tree->rankLower(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  size_type rank(const K& key) { return tree->rankLower(key); }
+
   template <typename... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     std::vector<std::pair<iterator, bool>> result;
@@ -123,7 +211,7 @@ class map {
   }
 
  private:
-  BinaryTree<key_type, value_type, mapCompare>* tree;
+  tree_type* tree;
 };
 
 }  // namespace s21
@@ -0,0 +1,233 @@
+#ifndef SRC_S21_MEMORY_RESOURCE_H_
+#define SRC_S21_MEMORY_RESOURCE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+namespace s21 {
+namespace pmr {
+// Bump-pointer arena: allocation advances a cursor through the current
+// chunk, deallocation does nothing and release() or the destructor give
+// every chunk back to upstream at once. Starts in an optional caller
+// buffer, then takes chunks from upstream that double in size. Meant for
+// request-scoped data that dies together. Not thread-safe.
+class monotonic_resource : public std::pmr::memory_resource {
+ public:
+  explicit monotonic_resource(
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : upstream_(upstream) {}
+
+  explicit monotonic_resource(
+      std::size_t initial_size,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : upstream_(upstream),
+        firstChunk_(std::max(initial_size, kMinChunk)),
+        nextChunk_(firstChunk_) {}
+
+  monotonic_resource(
+      void *buffer, std::size_t size,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : upstream_(upstream),
+        buffer_(static_cast<char *>(buffer)),
+        bufferSize_(size),
+        next_(buffer_),
+        end_(buffer_ + size),
+        firstChunk_(std::max(size * 2, kMinChunk)),
+        nextChunk_(firstChunk_) {}
+
+  monotonic_resource(const monotonic_resource &) = delete;
+  monotonic_resource &operator=(const monotonic_resource &) = delete;
+
+  ~monotonic_resource() override { release(); }
+
+  // Frees every chunk and rewinds to the start of the caller buffer, so the
+  // chunk sizes start over as well.
+  void release() noexcept {
+    while (chunks_ != nullptr) {
+      Chunk *prev = chunks_->prev;
+      upstream_->deallocate(chunks_, chunks_->bytes, alignof(Chunk));
+      chunks_ = prev;
+    }
+    next_ = buffer_;
+    end_ = buffer_ + bufferSize_;
+    nextChunk_ = firstChunk_;
+  }
+
+  std::pmr::memory_resource *upstream_resource() const noexcept {
+    return upstream_;
+  }
+
+ protected:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    void *p = bump(bytes, alignment);
+    if (p == nullptr) {
+      addChunk(bytes + alignment);
+      p = bump(bytes, alignment);
+    }
+    return p;
+  }
+
+  void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  static constexpr std::size_t kMinChunk = 1024;
+
+  struct alignas(std::max_align_t) Chunk {
+    Chunk *prev;
+    std::size_t bytes;
+  };
+
+  void *bump(std::size_t bytes, std::size_t alignment) noexcept {
+    if (next_ == nullptr) return nullptr;
+    std::uintptr_t at = reinterpret_cast<std::uintptr_t>(next_);
+    std::uintptr_t aligned = (at + alignment - 1) & ~(alignment - 1);
+    std::size_t room = end_ - next_;
+    if (aligned - at > room || bytes > room - (aligned - at)) return nullptr;
+    next_ = reinterpret_cast<char *>(aligned) + bytes;
+    return reinterpret_cast<void *>(aligned);
+  }
+
+  void addChunk(std::size_t need) {
+    std::size_t bytes = std::max(nextChunk_, need + sizeof(Chunk));
+    void *p = upstream_->allocate(bytes, alignof(Chunk));
+    chunks_ = ::new (p) Chunk{chunks_, bytes};
+    next_ = reinterpret_cast<char *>(chunks_ + 1);
+    end_ = static_cast<char *>(p) + bytes;
+    nextChunk_ = bytes * 2;
+  }
+
+  std::pmr::memory_resource *upstream_;
+  char *buffer_ = nullptr;
+  std::size_t bufferSize_ = 0;
+  char *next_ = nullptr;
+  char *end_ = nullptr;
+  std::size_t firstChunk_ = kMinChunk;
+  std::size_t nextChunk_ = kMinChunk;
+  Chunk *chunks_ = nullptr;
+};
+
+// Size-class pool: blocks of up to kMaxBlock bytes are rounded up to a
+// power of two and served from per-class free lists, refilled from chunks
+// taken from upstream. Freed blocks are recycled, not returned, until
+// release() or the destructor. Larger or over-aligned blocks go straight to
+// upstream. Not thread-safe.
+class pool_resource : public std::pmr::memory_resource {
+ public:
+  static constexpr std::size_t kMaxBlock = 4096;
+
+  explicit pool_resource(
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+      : upstream_(upstream) {}
+
+  pool_resource(const pool_resource &) = delete;
+  pool_resource &operator=(const pool_resource &) = delete;
+
+  ~pool_resource() override { release(); }
+
+  // Gives every chunk back to upstream. Blocks larger than kMaxBlock are
+  // not tracked and have to be deallocated by their owners.
+  void release() noexcept {
+    while (chunks_ != nullptr) {
+      Chunk *prev = chunks_->prev;
+      upstream_->deallocate(chunks_, chunks_->bytes, alignof(Chunk));
+      chunks_ = prev;
+    }
+    for (Pool &pool : pools_) pool = Pool();
+  }
+
+  std::pmr::memory_resource *upstream_resource() const noexcept {
+    return upstream_;
+  }
+
+ protected:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    std::size_t index = classOf(bytes, alignment);
+    if (index == kClasses) return upstream_->allocate(bytes, alignment);
+    Pool &pool = pools_[index];
+    if (pool.free != nullptr) {
+      FreeBlock *block = pool.free;
+      pool.free = block->next;
+      return block;
+    }
+    std::size_t size = kMinBlock << index;
+    if (pool.next == pool.end) refill(pool, size);
+    void *p = pool.next;
+    pool.next += size;
+    return p;
+  }
+
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::size_t index = classOf(bytes, alignment);
+    if (index == kClasses) {
+      upstream_->deallocate(p, bytes, alignment);
+      return;
+    }
+    pools_[index].free = ::new (p) FreeBlock{pools_[index].free};
+  }
+
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+ private:
+  static constexpr std::size_t kMinBlock = 8;
+  static constexpr std::size_t kClasses = 10;  // 8 .. 4096 bytes
+  static constexpr std::size_t kBlocksPerChunk = 32;
+
+  struct alignas(std::max_align_t) Chunk {
+    Chunk *prev;
+    std::size_t bytes;
+  };
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  struct Pool {
+    FreeBlock *free = nullptr;
+    char *next = nullptr;
+    char *end = nullptr;
+    std::size_t blocks = kBlocksPerChunk;
+  };
+
+  // Index of the smallest class that holds bytes at the given alignment,
+  // kClasses when the block bypasses the pools. Blocks sit at multiples of
+  // their size from a max_align_t-aligned start, so a class is aligned to
+  // its size up to alignof(std::max_align_t).
+  static std::size_t classOf(std::size_t bytes, std::size_t alignment) {
+    if (alignment > alignof(std::max_align_t)) return kClasses;
+    std::size_t size = std::max(bytes, alignment);
+    std::size_t index = 0;
+    while (index < kClasses && (kMinBlock << index) < size) ++index;
+    return index;
+  }
+
+  // Carves a new chunk for pool, twice as many blocks as the last one, up
+  // to 64 KiB.
+  void refill(Pool &pool, std::size_t size) {
+    std::size_t bytes = sizeof(Chunk) + pool.blocks * size;
+    void *p = upstream_->allocate(bytes, alignof(Chunk));
+    chunks_ = ::new (p) Chunk{chunks_, bytes};
+    pool.next = reinterpret_cast<char *>(chunks_ + 1);
+    pool.end = pool.next + pool.blocks * size;
+    if (pool.blocks * size < (std::size_t(64) << 10)) pool.blocks *= 2;
+  }
+
+  std::pmr::memory_resource *upstream_;
+  Chunk *chunks_ = nullptr;
+  Pool pools_[kClasses];
+};
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // SRC_S21_MEMORY_RESOURCE_H_
@@ -0,0 +1,437 @@
+#ifndef SRC_S21_MMAP_VECTOR_H_
+#define SRC_S21_MMAP_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_span.h"
+#include "s21_utility.h"
+#include "s21_vector.h"
+
+namespace s21 {
+enum class mmap_mode { read_write, read_only };
+
+// Vector whose storage is a file mapped with mmap, so its contents persist
+// and reopening is a mapping rather than a read and a copy: pages come in
+// from the page cache on first touch. The file holds a 64-byte header
+// (magic, element size, size) followed by the elements; reserved capacity
+// is file space past them and is trimmed on close. Growth extends the file
+// with ftruncate and the mapping with mremap, which may move it and so
+// invalidates iterators like vector reallocation does.
+//
+// Only for trivially copyable T, stored as raw bytes in host byte order.
+// Changes reach the page cache at once and disk when the kernel writes them
+// back; flush() forces that. A read-only vector throws from every
+// modifying member, and writing through its references or data() faults.
+// Not safe against concurrent writers of the same file.
+template <typename T>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_vector stores raw bytes, T must be trivially copyable");
+  static_assert(alignof(T) <= 64, "mmap_vector aligns elements to 64 bytes");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  mmap_vector() noexcept = default;
+
+  // Opens path, creating an empty vector file when it does not exist and
+  // mode is read_write.
+  explicit mmap_vector(const std::string &path,
+                       mmap_mode mode = mmap_mode::read_write)
+      : readOnly_(mode == mmap_mode::read_only) {
+    fd_ = ::open(path.c_str(), readOnly_ ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) throwErrno_("open");
+    try {
+      attach_();
+    } catch (...) {
+      closeFile_();
+      throw;
+    }
+  }
+
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector &operator=(const mmap_vector &) = delete;
+
+  mmap_vector(mmap_vector &&v) noexcept { swap(v); }
+
+  mmap_vector &operator=(mmap_vector &&v) noexcept {
+    if (this != &v) {
+      close();
+      swap(v);
+    }
+    return *this;
+  }
+
+  ~mmap_vector() { close(); }
+
+  bool is_open() const noexcept { return fd_ >= 0; }
+  bool is_read_only() const noexcept { return readOnly_; }
+
+  // Unmaps and closes the file, first trimming unused capacity from it.
+  void close() noexcept {
+    if (!is_open()) return;
+    ::munmap(map_, mapBytes_);
+    if (!readOnly_) {
+      // Best effort: a failure only leaves the reserved tail in the file.
+      [[maybe_unused]] int result = ::ftruncate(fd_, fileBytes_(size_));
+    }
+    closeFile_();
+  }
+
+  // Writes dirty pages of the header and the elements to disk, waiting for
+  // completion unless async.
+  void flush(bool async = false) {
+    checkWritable_();
+    if (::msync(map_, fileBytes_(size_), async ? MS_ASYNC : MS_SYNC) != 0) {
+      throwErrno_("msync");
+    }
+  }
+
+  // Views of the elements, e.g. span<const T> to hand to code written for
+  // s21::vector.
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible<T (*)[], U (*)[]>::value>>
+  operator span<U>() noexcept {
+    return span<U>(data(), size_);
+  }
+
+  template <typename U, typename = std::enable_if_t<std::is_convertible<
+                            const T (*)[], U (*)[]>::value>>
+  operator span<U>() const noexcept {
+    return span<U>(data(), size_);
+  }
+
+  reference at(size_type pos) {
+    checkIndex_(pos);
+    return data()[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    checkIndex_(pos);
+    return data()[pos];
+  }
+
+  reference operator[](size_type pos) noexcept {
+    S21_CONTAINERS_ASSERT(pos < size_, "mmap_vector index out of range");
+    return data()[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    S21_CONTAINERS_ASSERT(pos < size_, "mmap_vector index out of range");
+    return data()[pos];
+  }
+
+  reference front() noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "front() of an empty mmap_vector");
+    return data()[0];
+  }
+
+  const_reference front() const noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "front() of an empty mmap_vector");
+    return data()[0];
+  }
+
+  reference back() noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "back() of an empty mmap_vector");
+    return data()[size_ - 1];
+  }
+
+  const_reference back() const noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "back() of an empty mmap_vector");
+    return data()[size_ - 1];
+  }
+
+  pointer data() noexcept {
+    return map_ == nullptr ? nullptr
+                           : reinterpret_cast<pointer>(map_ + kHeaderBytes);
+  }
+
+  const_pointer data() const noexcept {
+    return map_ == nullptr
+               ? nullptr
+               : reinterpret_cast<const_pointer>(map_ + kHeaderBytes);
+  }
+
+  iterator begin() noexcept { return data(); }
+  const_iterator begin() const noexcept { return data(); }
+
+  iterator end() noexcept { return data() + size_; }
+  const_iterator end() const noexcept { return data() + size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return (std::numeric_limits<off_t>::max() - kHeaderBytes) /
+           sizeof(value_type);
+  }
+
+  void reserve(size_type size) {
+    checkWritable_();
+    if (size > capacity_) remap_(size);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  void shrink_to_fit() {
+    checkWritable_();
+    if (size_ < capacity_) remap_(size_);
+  }
+
+  void clear() {
+    checkWritable_();
+    setSize_(0);
+  }
+
+  void resize(size_type count, const_reference value = value_type()) {
+    checkWritable_();
+    if (count > capacity_) {
+      value_type copy(value);
+      growFor_(count - size_);
+      std::fill(data() + size_, data() + count, copy);
+    } else if (count > size_) {
+      std::fill(data() + size_, data() + count, value);
+    }
+    setSize_(count);
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    size_type index_pos = checkPosition_(pos);
+    value_type copy(value);
+    growFor_(1);
+    pointer p = data() + index_pos;
+    std::memmove(static_cast<void *>(p + 1), p,
+                 (size_ - index_pos) * sizeof(value_type));
+    std::memcpy(static_cast<void *>(p), &copy, sizeof(value_type));
+    setSize_(size_ + 1);
+    return p;
+  }
+
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index_pos = checkPosition_(pos);
+    size_type old_size = size_;
+    for (; first != last; ++first) push_back(*first);
+    std::rotate(data() + index_pos, data() + old_size, data() + size_);
+    return data() + index_pos;
+  }
+
+  void erase(iterator pos) {
+    if (pos == end()) {
+      throw std::length_error("Pos must point to vector element");
+    }
+    erase(pos, pos + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    checkWritable_();
+    size_type from = checkPosition_(first);
+    size_type to = checkPosition_(last);
+    if (from > to) {
+      throw std::length_error("Invalid erase range");
+    }
+    std::memmove(static_cast<void *>(data() + from), data() + to,
+                 (size_ - to) * sizeof(value_type));
+    setSize_(size_ - (to - from));
+    return data() + from;
+  }
+
+  void push_back(const_reference value) {
+    if (size_ == capacity_) {
+      value_type copy(value);
+      growFor_(1);
+      std::memcpy(static_cast<void *>(data() + size_), &copy,
+                  sizeof(value_type));
+    } else {
+      checkWritable_();
+      std::memcpy(static_cast<void *>(data() + size_), &value,
+                  sizeof(value_type));
+    }
+    setSize_(size_ + 1);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    push_back(value_type(std::forward<Args>(args)...));
+    return back();
+  }
+
+  void pop_back() {
+    checkWritable_();
+    if (size_ == 0) {
+      throw std::length_error("Cant pop_back from zero length vector");
+    }
+    setSize_(size_ - 1);
+  }
+
+  void swap(mmap_vector &other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(readOnly_, other.readOnly_);
+    std::swap(map_, other.map_);
+    std::swap(mapBytes_, other.mapBytes_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  static constexpr size_type kHeaderBytes = 64;
+  static constexpr uint64_t kMagic = 0x3176656d6d313273;  // "s21mmev1"
+
+  struct Header {
+    uint64_t magic;
+    uint64_t elementSize;
+    uint64_t size;
+  };
+
+  int fd_ = -1;
+  bool readOnly_ = false;
+  unsigned char *map_ = nullptr;
+  size_type mapBytes_ = 0;
+  size_type size_ = 0;
+  size_type capacity_ = 0;
+
+  [[noreturn]] static void throwErrno_(const char *what) {
+    throw std::system_error(errno, std::generic_category(),
+                            std::string("mmap_vector: ") + what);
+  }
+
+  static size_type fileBytes_(size_type count) noexcept {
+    return kHeaderBytes + count * sizeof(value_type);
+  }
+
+  Header *header_() noexcept { return reinterpret_cast<Header *>(map_); }
+
+  // Maps the open file, writing a header into an empty one and checking
+  // the header of any other.
+  void attach_() {
+    struct stat info;
+    if (::fstat(fd_, &info) != 0) throwErrno_("fstat");
+    size_type bytes = static_cast<size_type>(info.st_size);
+    bool fresh = bytes == 0;
+    if (fresh) {
+      if (readOnly_) {
+        throw std::runtime_error("mmap_vector: empty file opened read-only");
+      }
+      bytes = kHeaderBytes;
+      if (::ftruncate(fd_, bytes) != 0) throwErrno_("ftruncate");
+    } else if (bytes < kHeaderBytes) {
+      throw std::runtime_error("mmap_vector: file too short for a header");
+    }
+    int protection = readOnly_ ? PROT_READ : PROT_READ | PROT_WRITE;
+    void *p = ::mmap(nullptr, bytes, protection, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) throwErrno_("mmap");
+    map_ = static_cast<unsigned char *>(p);
+    mapBytes_ = bytes;
+    capacity_ = (bytes - kHeaderBytes) / sizeof(value_type);
+    if (fresh) {
+      *header_() = Header{kMagic, sizeof(value_type), 0};
+    } else if (header_()->magic != kMagic ||
+               header_()->elementSize != sizeof(value_type) ||
+               header_()->size > capacity_) {
+      ::munmap(map_, mapBytes_);
+      map_ = nullptr;
+      throw std::runtime_error("mmap_vector: not a vector file of this type");
+    }
+    size_ = header_()->size;
+  }
+
+  void closeFile_() noexcept {
+    ::close(fd_);
+    fd_ = -1;
+    map_ = nullptr;
+    mapBytes_ = 0;
+    size_ = 0;
+    capacity_ = 0;
+  }
+
+  void checkWritable_() const {
+    if (!is_open()) throw std::logic_error("mmap_vector is not open");
+    if (readOnly_) throw std::logic_error("mmap_vector is read-only");
+  }
+
+  void checkIndex_(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+  }
+
+  size_type checkPosition_(const_pointer pos) const {
+    if (pos < data() || pos > data() + size_) {
+      throw std::length_error("Pos must point to vector element");
+    }
+    return pos - data();
+  }
+
+  void setSize_(size_type size) noexcept {
+    size_ = size;
+    header_()->size = size;
+  }
+
+  // Makes room for count more elements, growing by vector_growth<T>.
+  void growFor_(size_type count) {
+    checkWritable_();
+    if (size_ + count <= capacity_) return;
+    using growth = vector_growth<value_type>;
+    size_type grown = capacity_ == 0
+                          ? std::max<size_type>(growth::kMinCapacity, 1)
+                          : capacity_ * growth::kNumerator /
+                                growth::kDenominator;
+    remap_(std::max(size_ + count, grown));
+  }
+
+  // Resizes the file to new_capacity elements and the mapping with it.
+  void remap_(size_type new_capacity) {
+    if (new_capacity > max_size()) {
+      throw std::length_error("mmap_vector capacity exceeds max_size");
+    }
+    size_type bytes = fileBytes_(new_capacity);
+    if (bytes > mapBytes_ && ::ftruncate(fd_, bytes) != 0) {
+      throwErrno_("ftruncate");
+    }
+#ifdef MREMAP_MAYMOVE
+    void *p = ::mremap(map_, mapBytes_, bytes, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) throwErrno_("mremap");
+#else
+    void *p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+                     0);
+    if (p == MAP_FAILED) throwErrno_("mmap");
+    ::munmap(map_, mapBytes_);
+#endif
+    bool shrunk = bytes < mapBytes_;
+    map_ = static_cast<unsigned char *>(p);
+    mapBytes_ = bytes;
+    capacity_ = new_capacity;
+    if (shrunk) {
+      // Best effort, as in close(): the mapping already has its new size,
+      // and a failure only leaves the trimmed tail in the file.
+      [[maybe_unused]] int result = ::ftruncate(fd_, bytes);
+    }
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_MMAP_VECTOR_H_
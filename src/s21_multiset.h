@@ -4,7 +4,8 @@
 #include "s21_binary_tree.h"
 
 namespace s21 {
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
 class multiset {
  public:
   using key_type = Key;
@@ -12,31 +13,50 @@ class multiset {
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Allocator;
 
-  struct multisetCompare {
-    bool operator()(const value_type& a, const value_type& b) const noexcept {
-      return a < b;
+  struct multisetCompare : EboStorage<Compare> {
+    using is_transparent = void;
+
+    multisetCompare() = default;
+    explicit multisetCompare(const Compare& comp) : EboStorage<Compare>(comp) {}
+
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      return this->get()(a, b);
     }
   };
 
-  using iterator =
-      typename BinaryTree<key_type, value_type, multisetCompare>::iterator;
-  using const_iterator = typename BinaryTree<key_type, value_type,
-                                             multisetCompare>::const_iterator;
-  using Node = typename BinaryTree<key_type, value_type, multisetCompare>::Node;
+  using tree_type =
+      BinaryTree<key_type, value_type, multisetCompare, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using Node = typename tree_type::Node;
+
+  multiset() : tree(new tree_type) {}
 
-  multiset() : tree(new BinaryTree<key_type, value_type, multisetCompare>) {}
+  explicit multiset(const Allocator& alloc) : tree(new tree_type(alloc)) {}
+
+  explicit multiset(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree(new tree_type(multisetCompare(comp), alloc)) {}
 
   multiset(std::initializer_list<value_type> const& items)
-      : tree(new BinaryTree<value_type, value_type, multisetCompare>()) {
-    for (auto item : items) {
-      insert(item);
-    }
+      : tree(new tree_type) {
+    tree->assignSorted(items.begin(), items.end(), false);
+  }
+
+  // Builds a perfectly balanced tree in O(n) from sorted input, unsorted
+  // input is sorted first.
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  multiset(InputIt first, InputIt last) : tree(new tree_type) {
+    tree->assignSorted(first, last, false);
   }
 
-  multiset(const multiset& ms) : tree(new BinaryTree(*ms.tree)) {}
+  multiset(const multiset& ms) : tree(new tree_type(*ms.tree)) {}
 
-  multiset(multiset&& ms) : tree(new BinaryTree(std::move(*ms.tree))) {}
+  multiset(multiset&& ms) : tree(new tree_type(std::move(*ms.tree))) {}
 
   multiset& operator=(multiset& ms) {
     *tree = *ms.tree;
@@ -79,14 +99,30 @@ class multiset {
     return getIter.first;
   }
 
+  allocator_type get_allocator() const { return tree->get_allocator(); }
+
+  key_compare key_comp() const { return tree->value_comp().get(); }
+
+  value_compare value_comp() const { return tree->value_comp().get(); }
+
   void erase(iterator pos) { tree->erase(pos); }
 
   bool contains(const Key& key) { return tree->contains(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  bool contains(const K& key) { return tree->contains(key); }
+
   void swap(multiset& other) { std::swap(tree, other.tree); }
 
   void clear() { tree->clearTree(); }
 
+  // Replaces the contents with [first, last) in O(n) when the range is
+  // sorted, in O(n log n) otherwise.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree->assignSorted(first, last, false);
+  }
+
   void merge(multiset& other) {
     auto otherEnd = other.end();
     for (auto it = other.begin(); it != otherEnd; ++it) {
@@ -99,14 +135,38 @@ class multiset {
     return std::make_pair(lower_bound(key), upper_bound(key));
   }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  std::pair<iterator, iterator> equal_range(const K& key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
   iterator lower_bound(const Key& key) { return tree->findLowerBound(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator lower_bound(const K& key) { return tree->findLowerBound(key); }
+
   iterator upper_bound(const Key& key) { return tree->findUpperBound(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator upper_bound(const K& key) { return tree->findUpperBound(key); }
+
   iterator find(const Key& key) { return tree->find(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator find(const K& key) { return tree->find(key); }
+
   size_type count(const Key& key) { return tree->count(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  size_type count(const K& key) { return tree->count(key); }
+
+  iterator nth_element(size_type k) { return tree->nth(k); }
+
+  size_type rank(const Key& key) { return tree->rankLower(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  size_type rank(const K& key) { return tree->rankLower(key); }
+
   template <typename... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     std::vector<std::pair<iterator, bool>> result;
@@ -118,7 +178,7 @@ class multiset {
   }
 
  private:
-  BinaryTree<Key, Key, multisetCompare>* tree;
+  tree_type* tree;
 };
 
 }  // namespace s21
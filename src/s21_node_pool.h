@@ -0,0 +1,183 @@
+#ifndef SRC_S21_NODE_POOL_H_
+#define SRC_S21_NODE_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "s21_utility.h"
+
+namespace s21 {
+// Slab allocator for the nodes of node-based containers. Nodes are carved
+// from contiguous blocks obtained through Allocator, released nodes are
+// recycled through an intrusive free list and release() returns every block
+// at once, in O(blocks).
+template <typename Node, typename Allocator = std::allocator<Node>>
+class NodePool {
+ public:
+  using allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using size_type = std::size_t;
+
+  NodePool() = default;
+  explicit NodePool(const allocator_type &alloc) : alloc_(alloc) {}
+
+  NodePool(const NodePool &other) = delete;
+  NodePool &operator=(const NodePool &other) = delete;
+
+  NodePool(NodePool &&other) noexcept : alloc_(std::move(other.alloc_)) {
+    steal(other);
+  }
+
+  // Takes the blocks of other. The allocator follows them only when it
+  // propagates on move assignment; otherwise the two have to compare equal,
+  // which owners check with canAdopt() before moving a pool.
+  NodePool &operator=(NodePool &&other) noexcept {
+    if (this != &other) {
+      release();
+      if constexpr (traits::propagate_on_container_move_assignment::value) {
+        alloc_ = std::move(other.alloc_);
+      } else {
+        S21_CONTAINERS_ASSERT(alloc_ == other.alloc_,
+                              "moving nodes between unequal allocators");
+      }
+      steal(other);
+    }
+    return *this;
+  }
+
+  ~NodePool() { release(); }
+
+  template <typename... Args>
+  Node *create(Args &&...args) {
+    Node *node = allocate();
+    try {
+      traits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(node);
+      throw;
+    }
+    return node;
+  }
+
+  void destroy(Node *node) noexcept {
+    traits::destroy(alloc_, node);
+    deallocate(node);
+  }
+
+  // Returns all blocks to the allocator. Nodes still alive are not
+  // destroyed, the owner has to do it beforehand if that matters.
+  void release() noexcept {
+    while (blocks_ != nullptr) {
+      Block *prev = blocks_->prev;
+      traits::deallocate(alloc_, reinterpret_cast<Node *>(blocks_),
+                         blocks_->slots);
+      blocks_ = prev;
+    }
+    free_ = nullptr;
+    next_ = nullptr;
+    end_ = nullptr;
+    blockSlots_ = kMinBlockSlots;
+  }
+
+  // Whether operator=(NodePool &&) may take the blocks of other.
+  bool canAdopt(const NodePool &other) const noexcept {
+    return traits::propagate_on_container_move_assignment::value ||
+           alloc_ == other.alloc_;
+  }
+
+  // Allocators are exchanged only when they propagate on swap; otherwise
+  // they must compare equal.
+  void swap(NodePool &other) noexcept {
+    if constexpr (traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    } else {
+      S21_CONTAINERS_ASSERT(alloc_ == other.alloc_,
+                            "swapping pools with unequal allocators");
+    }
+    swapBlocks(other);
+  }
+
+  // Exchanges the blocks together with the allocators whatever the
+  // propagation traits say. For an owner that built other as the
+  // replacement of its own contents, with the allocator it is to end up
+  // with.
+  void exchange(NodePool &other) noexcept {
+    std::swap(alloc_, other.alloc_);
+    swapBlocks(other);
+  }
+
+  allocator_type get_allocator() const { return alloc_; }
+
+ private:
+  void swapBlocks(NodePool &other) noexcept {
+    std::swap(blocks_, other.blocks_);
+    std::swap(free_, other.free_);
+    std::swap(next_, other.next_);
+    std::swap(end_, other.end_);
+    std::swap(blockSlots_, other.blockSlots_);
+  }
+
+  using traits = std::allocator_traits<allocator_type>;
+
+  // The first slot of every block holds its header.
+  struct Block {
+    Block *prev;
+    size_type slots;
+  };
+
+  struct FreeSlot {
+    FreeSlot *next;
+  };
+
+  static constexpr size_type kMinBlockSlots = 32;
+  static constexpr size_type kMaxBlockSlots = 4096;
+
+  Node *allocate() {
+    if (free_ != nullptr) {
+      FreeSlot *slot = free_;
+      free_ = slot->next;
+      return reinterpret_cast<Node *>(slot);
+    }
+    if (next_ == end_) grow();
+    return next_++;
+  }
+
+  void deallocate(Node *node) noexcept {
+    FreeSlot *slot = reinterpret_cast<FreeSlot *>(node);
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  void grow() {
+    static_assert(sizeof(Node) >= sizeof(Block), "node too small for pool");
+    Node *raw = traits::allocate(alloc_, blockSlots_);
+    blocks_ = ::new (static_cast<void *>(raw)) Block{blocks_, blockSlots_};
+    next_ = raw + 1;
+    end_ = raw + blockSlots_;
+    if (blockSlots_ < kMaxBlockSlots) blockSlots_ *= 2;
+  }
+
+  void steal(NodePool &other) noexcept {
+    blocks_ = other.blocks_;
+    free_ = other.free_;
+    next_ = other.next_;
+    end_ = other.end_;
+    blockSlots_ = other.blockSlots_;
+    other.blocks_ = nullptr;
+    other.free_ = nullptr;
+    other.next_ = nullptr;
+    other.end_ = nullptr;
+    other.blockSlots_ = kMinBlockSlots;
+  }
+
+  allocator_type alloc_;
+  Block *blocks_ = nullptr;
+  FreeSlot *free_ = nullptr;
+  Node *next_ = nullptr;
+  Node *end_ = nullptr;
+  size_type blockSlots_ = kMinBlockSlots;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_NODE_POOL_H_
@@ -38,7 +38,7 @@ class queue {
 
   template <typename... Args>
   void insert_many_back(Args&&... args) {
-    container_.insert_many_back(args...);
+    container_.insert_many_back(std::forward<Args>(args)...);
   }
 
  private:
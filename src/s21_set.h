@@ -4,7 +4,8 @@
 #include "s21_binary_tree.h"
 
 namespace s21 {
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<Key>>
 class set {
  public:
   using key_type = Key;
@@ -12,31 +13,49 @@ class set {
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = std::size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using allocator_type = Allocator;
 
-  struct setCompare {
-    bool operator()(const value_type& a, const value_type& b) const noexcept {
-      return a < b;
+  struct setCompare : EboStorage<Compare> {
+    using is_transparent = void;
+
+    setCompare() = default;
+    explicit setCompare(const Compare& comp) : EboStorage<Compare>(comp) {}
+
+    template <typename A, typename B>
+    bool operator()(const A& a, const B& b) const {
+      return this->get()(a, b);
     }
   };
 
-  using iterator = typename BinaryTree<Key, Key, setCompare>::iterator;
-  using const_iterator =
-      typename BinaryTree<Key, Key, setCompare>::const_iterator;
-  using Node = typename BinaryTree<Key, Key, setCompare>::Node;
+  using tree_type = BinaryTree<Key, Key, setCompare, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using Node = typename tree_type::Node;
 
   // default constructor, creates an empty set
-  set() : tree(new BinaryTree<Key, Key, setCompare>) {}
+  set() : tree(new tree_type) {}
 
-  set(std::initializer_list<value_type> const& items)
-      : tree(new BinaryTree<value_type, value_type, setCompare>()) {
-    for (auto item : items) {
-      insert(item);
-    }
+  explicit set(const Allocator& alloc) : tree(new tree_type(alloc)) {}
+
+  explicit set(const Compare& comp, const Allocator& alloc = Allocator())
+      : tree(new tree_type(setCompare(comp), alloc)) {}
+
+  set(std::initializer_list<value_type> const& items) : tree(new tree_type) {
+    tree->assignSorted(items.begin(), items.end(), true);
+  }
+
+  // Builds a perfectly balanced tree in O(n) from sorted input, unsorted
+  // input is sorted first.
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  set(InputIt first, InputIt last) : tree(new tree_type) {
+    tree->assignSorted(first, last, true);
   }
 
-  set(const set& s) : tree(new BinaryTree(*s.tree)) {}
+  set(const set& s) : tree(new tree_type(*s.tree)) {}
 
-  set(set&& s) : tree(new BinaryTree(std::move(*s.tree))) {}
+  set(set&& s) : tree(new tree_type(std::move(*s.tree))) {}
 
   set& operator=(set& s) {
     *tree = *s.tree;
@@ -78,11 +97,24 @@ class set {
     return tree->insertUnique(value);
   }
 
+  allocator_type get_allocator() const { return tree->get_allocator(); }
+
+  key_compare key_comp() const { return tree->value_comp().get(); }
+
+  value_compare value_comp() const { return tree->value_comp().get(); }
+
   void erase(iterator pos) { tree->erase(pos); }
   void swap(set& other) { std::swap(tree, other.tree); }
 
   void clear() { tree->clearTree(); }
 
+  // Replaces the contents with [first, last) in O(n) when the range is
+  // sorted, in O(n log n) otherwise.
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree->assignSorted(first, last, true);
+  }
+
   void merge(set& other) {
     auto otherEnd = other.end();
     for (auto it = other.begin(); it != otherEnd; ++it) {
@@ -93,8 +125,36 @@ class set {
 
   iterator find(const Key& key) { return tree->find(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator find(const K& key) { return tree->find(key); }
+
   bool contains(const Key& key) { return tree->contains(key); }
 
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  bool contains(const K& key) { return tree->contains(key); }
+
+  size_type count(const Key& key) { return contains(key) ? 1 : 0; }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  size_type count(const K& key) { return contains(key) ? 1 : 0; }
+
+  iterator lower_bound(const Key& key) { return tree->findLowerBound(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator lower_bound(const K& key) { return tree->findLowerBound(key); }
+
+  iterator upper_bound(const Key& key) { return tree->findUpperBound(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  iterator upper_bound(const K& key) { return tree->findUpperBound(key); }
+
+  iterator nth_element(size_type k) { return tree->nth(k); }
+
+  size_type rank(const Key& key) { return tree->rankLower(key); }
+
+  template <typename K, typename = enable_transparent_t<Compare, K>>
+  size_type rank(const K& key) { return tree->rankLower(key); }
+
   template <typename... Args>
   std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     std::vector<std::pair<iterator, bool>> result;
@@ -106,7 +166,7 @@ class set {
   }
 
  private:
-  BinaryTree<Key, Key, setCompare>* tree;
+  tree_type* tree;
 };
 
 }  // namespace s21
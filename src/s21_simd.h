@@ -0,0 +1,336 @@
+#ifndef SRC_S21_SIMD_H_
+#define SRC_S21_SIMD_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#endif
+
+namespace s21 {
+// Result type of simd::sum: integers are summed in 64 bits so that the
+// total cannot overflow before the range does.
+template <typename T>
+struct simd_sum {
+  using type = T;
+};
+
+template <>
+struct simd_sum<int32_t> {
+  using type = int64_t;
+};
+
+template <>
+struct simd_sum<uint8_t> {
+  using type = uint64_t;
+};
+
+#ifdef S21_SIMD_X86
+namespace simd_detail {
+inline bool hasAvx2() {
+  static const bool has = __builtin_cpu_supports("avx2");
+  return has;
+}
+
+// SSE2 is part of x86-64, so this set needs no dispatch.
+namespace sse2 {
+template <typename T>
+struct Lanes;
+
+template <>
+struct Lanes<int32_t> {
+  using reg = __m128i;
+  using acc = __m128i;
+  static constexpr size_t kWidth = 4;
+  static constexpr unsigned kAll = 0xF;
+
+  static reg load(const int32_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static void store(int32_t *p, reg v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+  }
+  static reg set1(int32_t x) { return _mm_set1_epi32(x); }
+  static unsigned eqMask(reg a, reg b) {
+    return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+  }
+  // SSE2 has no 32-bit min and max, so select through a compare.
+  static reg min(reg a, reg b) {
+    reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a));
+  }
+  static reg max(reg a, reg b) {
+    reg gt = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b));
+  }
+  static acc accZero() { return _mm_setzero_si128(); }
+  static acc accumulate(acc sum, reg v) {
+    reg sign = _mm_srai_epi32(v, 31);
+    return _mm_add_epi64(sum, _mm_add_epi64(_mm_unpacklo_epi32(v, sign),
+                                            _mm_unpackhi_epi32(v, sign)));
+  }
+  static int64_t reduce(acc sum) {
+    int64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), sum);
+    return lanes[0] + lanes[1];
+  }
+};
+
+template <>
+struct Lanes<float> {
+  using reg = __m128;
+  using acc = __m128;
+  static constexpr size_t kWidth = 4;
+  static constexpr unsigned kAll = 0xF;
+
+  static reg load(const float *p) { return _mm_loadu_ps(p); }
+  static void store(float *p, reg v) { _mm_storeu_ps(p, v); }
+  static reg set1(float x) { return _mm_set1_ps(x); }
+  static unsigned eqMask(reg a, reg b) {
+    return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+  }
+  static reg min(reg a, reg b) { return _mm_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_ps(a, b); }
+  static acc accZero() { return _mm_setzero_ps(); }
+  static acc accumulate(acc sum, reg v) { return _mm_add_ps(sum, v); }
+  static float reduce(acc sum) {
+    float lanes[4];
+    _mm_storeu_ps(lanes, sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+};
+
+template <>
+struct Lanes<uint8_t> {
+  using reg = __m128i;
+  using acc = __m128i;
+  static constexpr size_t kWidth = 16;
+  static constexpr unsigned kAll = 0xFFFF;
+
+  static reg load(const uint8_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static void store(uint8_t *p, reg v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v);
+  }
+  static reg set1(uint8_t x) { return _mm_set1_epi8(static_cast<char>(x)); }
+  static unsigned eqMask(reg a, reg b) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+  }
+  static reg min(reg a, reg b) { return _mm_min_epu8(a, b); }
+  static reg max(reg a, reg b) { return _mm_max_epu8(a, b); }
+  static acc accZero() { return _mm_setzero_si128(); }
+  static acc accumulate(acc sum, reg v) {
+    return _mm_add_epi64(sum, _mm_sad_epu8(v, _mm_setzero_si128()));
+  }
+  static uint64_t reduce(acc sum) {
+    uint64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), sum);
+    return lanes[0] + lanes[1];
+  }
+};
+
+#include "s21_simd_kernels.inc"
+}  // namespace sse2
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+namespace avx2 {
+template <typename T>
+struct Lanes;
+
+template <>
+struct Lanes<int32_t> {
+  using reg = __m256i;
+  using acc = __m256i;
+  static constexpr size_t kWidth = 8;
+  static constexpr unsigned kAll = 0xFF;
+
+  static reg load(const int32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static void store(int32_t *p, reg v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+  static reg set1(int32_t x) { return _mm256_set1_epi32(x); }
+  static unsigned eqMask(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+  }
+  static reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+  static acc accZero() { return _mm256_setzero_si256(); }
+  static acc accumulate(acc sum, reg v) {
+    reg wide = _mm256_add_epi64(
+        _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)),
+        _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    return _mm256_add_epi64(sum, wide);
+  }
+  static int64_t reduce(acc sum) {
+    int64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+};
+
+template <>
+struct Lanes<float> {
+  using reg = __m256;
+  using acc = __m256;
+  static constexpr size_t kWidth = 8;
+  static constexpr unsigned kAll = 0xFF;
+
+  static reg load(const float *p) { return _mm256_loadu_ps(p); }
+  static void store(float *p, reg v) { _mm256_storeu_ps(p, v); }
+  static reg set1(float x) { return _mm256_set1_ps(x); }
+  static unsigned eqMask(reg a, reg b) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+  }
+  static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+  static acc accZero() { return _mm256_setzero_ps(); }
+  static acc accumulate(acc sum, reg v) { return _mm256_add_ps(sum, v); }
+  static float reduce(acc sum) {
+    float lanes[8];
+    _mm256_storeu_ps(lanes, sum);
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) +
+           ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+  }
+};
+
+template <>
+struct Lanes<uint8_t> {
+  using reg = __m256i;
+  using acc = __m256i;
+  static constexpr size_t kWidth = 32;
+  static constexpr unsigned kAll = 0xFFFFFFFF;
+
+  static reg load(const uint8_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static void store(uint8_t *p, reg v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+  }
+  static reg set1(uint8_t x) { return _mm256_set1_epi8(static_cast<char>(x)); }
+  static unsigned eqMask(reg a, reg b) {
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+  }
+  static reg min(reg a, reg b) { return _mm256_min_epu8(a, b); }
+  static reg max(reg a, reg b) { return _mm256_max_epu8(a, b); }
+  static acc accZero() { return _mm256_setzero_si256(); }
+  static acc accumulate(acc sum, reg v) {
+    return _mm256_add_epi64(sum, _mm256_sad_epu8(v, _mm256_setzero_si256()));
+  }
+  static uint64_t reduce(acc sum) {
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), sum);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+  }
+};
+
+#include "s21_simd_kernels.inc"
+}  // namespace avx2
+#pragma GCC pop_options
+}  // namespace simd_detail
+#endif  // S21_SIMD_X86
+
+// Kernels over contiguous ranges used by s21::vector and s21::array. For
+// int32_t, float and uint8_t they run on AVX2 when the CPU has it and on
+// SSE2 otherwise; every other type, and every other target, takes a plain
+// loop. Float results follow the vector instructions: min and max of a
+// range with NaNs are unspecified, and sum adds in a different order than a
+// sequential loop, so its rounding may differ in the last bits.
+namespace simd {
+template <typename T>
+inline constexpr bool kVectorized =
+#ifdef S21_SIMD_X86
+    std::is_same<T, int32_t>::value || std::is_same<T, float>::value ||
+    std::is_same<T, uint8_t>::value;
+#else
+    false;
+#endif
+
+template <typename T>
+void fill(T *first, size_t n, const T &value) {
+  if constexpr (std::is_same<T, uint8_t>::value) {
+    // The C library's byte fill is already as wide as it gets.
+    std::memset(first, value, n);
+  } else if constexpr (kVectorized<T>) {
+    if (simd_detail::hasAvx2()) return simd_detail::avx2::fill(first, n, value);
+    return simd_detail::sse2::fill(first, n, value);
+  } else {
+    std::fill_n(first, n, value);
+  }
+}
+
+template <typename T>
+void swap_ranges(T *a, T *b, size_t n) {
+  if constexpr (kVectorized<T>) {
+    if (simd_detail::hasAvx2()) return simd_detail::avx2::swap_ranges(a, b, n);
+    return simd_detail::sse2::swap_ranges(a, b, n);
+  } else {
+    std::swap_ranges(a, a + n, b);
+  }
+}
+
+template <typename T>
+bool equal(const T *a, const T *b, size_t n) {
+  if constexpr (kVectorized<T>) {
+    if (simd_detail::hasAvx2()) return simd_detail::avx2::equal(a, b, n);
+    return simd_detail::sse2::equal(a, b, n);
+  } else {
+    return std::equal(a, a + n, b);
+  }
+}
+
+// Index of the first element equal to value, n when there is none.
+template <typename T>
+size_t find(const T *first, size_t n, const T &value) {
+  if constexpr (kVectorized<T>) {
+    if (simd_detail::hasAvx2()) return simd_detail::avx2::find(first, n, value);
+    return simd_detail::sse2::find(first, n, value);
+  } else {
+    return std::find(first, first + n, value) - first;
+  }
+}
+
+// min and max need n > 0.
+template <typename T>
+T min(const T *first, size_t n) {
+  if constexpr (kVectorized<T>) {
+    if (simd_detail::hasAvx2()) return simd_detail::avx2::min(first, n);
+    return simd_detail::sse2::min(first, n);
+  } else {
+    return *std::min_element(first, first + n);
+  }
+}
+
+template <typename T>
+T max(const T *first, size_t n) {
+  if constexpr (kVectorized<T>) {
+    if (simd_detail::hasAvx2()) return simd_detail::avx2::max(first, n);
+    return simd_detail::sse2::max(first, n);
+  } else {
+    return *std::max_element(first, first + n);
+  }
+}
+
+template <typename T>
+typename simd_sum<T>::type sum(const T *first, size_t n) {
+  if constexpr (kVectorized<T>) {
+    if (simd_detail::hasAvx2()) return simd_detail::avx2::sum(first, n);
+    return simd_detail::sse2::sum(first, n);
+  } else {
+    return std::accumulate(first, first + n, typename simd_sum<T>::type());
+  }
+}
+}  // namespace simd
+}  // namespace s21
+
+#endif  // SRC_S21_SIMD_H_
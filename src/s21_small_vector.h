@@ -0,0 +1,415 @@
+#ifndef SRC_S21_SMALL_VECTOR_H_
+#define SRC_S21_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_utility.h"
+#include "s21_vector.h"
+#include "s21_vector_detail.h"
+
+namespace s21 {
+// Vector that keeps up to N elements in a buffer inside the object and
+// moves them to the heap once it outgrows it, so short vectors cost no
+// allocation at all. Grows past N with vector_growth<T>. Moving or swapping
+// an inline vector moves its elements one by one, and iterators into it are
+// invalidated by that; a heap vector hands over its buffer as s21::vector
+// does.
+template <typename T, size_t N>
+class small_vector {
+  static_assert(N > 0, "small_vector needs room for at least one element");
+  using Ops = vector_detail::Ops;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  small_vector() noexcept : data_(inline_()), size_(0), capacity_(N) {}
+
+  explicit small_vector(size_type n) : small_vector() {
+    reserve(n);
+    std::uninitialized_value_construct_n(data_, n);
+    size_ = n;
+  }
+
+  small_vector(size_type n, const_reference value) : small_vector() {
+    reserve(n);
+    std::uninitialized_fill_n(data_, n, value);
+    size_ = n;
+  }
+
+  small_vector(std::initializer_list<value_type> const &items)
+      : small_vector() {
+    reserve(items.size());
+    std::uninitialized_copy(items.begin(), items.end(), data_);
+    size_ = items.size();
+  }
+
+  small_vector(const small_vector &v) : small_vector() {
+    reserve(v.size_);
+    std::uninitialized_copy(v.data_, v.data_ + v.size_, data_);
+    size_ = v.size_;
+  }
+
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value)
+      : small_vector() {
+    takeFrom_(v);
+  }
+
+  ~small_vector() { setInline_(); }
+
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    if (this != &v) {
+      setInline_();
+      takeFrom_(v);
+    }
+    return *this;
+  }
+
+  small_vector &operator=(const small_vector &v) {
+    if (this != &v) {
+      small_vector copy(v);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    checkIndex_(pos);
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    checkIndex_(pos);
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) noexcept {
+    S21_CONTAINERS_ASSERT(pos < size_, "small_vector index out of range");
+    return data_[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    S21_CONTAINERS_ASSERT(pos < size_, "small_vector index out of range");
+    return data_[pos];
+  }
+
+  reference front() noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "front() of an empty small_vector");
+    return data_[0];
+  }
+
+  const_reference front() const noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "front() of an empty small_vector");
+    return data_[0];
+  }
+
+  reference back() noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "back() of an empty small_vector");
+    return data_[size_ - 1];
+  }
+
+  const_reference back() const noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "back() of an empty small_vector");
+    return data_[size_ - 1];
+  }
+
+  pointer data() noexcept { return data_; }
+  const_pointer data() const noexcept { return data_; }
+
+  iterator begin() noexcept { return data_; }
+  const_iterator begin() const noexcept { return data_; }
+
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  // True while the elements live in the buffer inside the object.
+  bool is_inline() const noexcept { return data_ == inline_(); }
+
+  void reserve(size_type size) {
+    if (size > capacity_) reallocate_(size);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  // Moves the elements back inline when they fit there.
+  void shrink_to_fit() {
+    if (size_ < capacity_) reallocate_(size_);
+  }
+
+  void clear() noexcept {
+    std::destroy(data_, data_ + size_);
+    size_ = 0;
+  }
+
+  void resize(size_type count) {
+    Ops::resizeWith(*this, count, [](pointer first, size_type n) {
+      std::uninitialized_value_construct_n(first, n);
+    });
+  }
+
+  void resize(size_type count, const_reference value) {
+    // value may be an element of this vector.
+    value_type copy(value);
+    Ops::resizeWith(*this, count, [&copy](pointer first, size_type n) {
+      std::uninitialized_fill_n(first, n, copy);
+    });
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value) {
+    size_type index_pos = checkPosition_(pos);
+    value_type copy(value);
+    Ops::fillGap(*this, index_pos, count, [&copy](pointer gap, size_type n) {
+      std::uninitialized_fill_n(gap, n, copy);
+    });
+    return data_ + index_pos;
+  }
+
+  // Inserts [first, last), which must not point into this vector.
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index_pos = checkPosition_(pos);
+    Ops::insertRange(*this, index_pos, first, last);
+    return data_ + index_pos;
+  }
+
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(end(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index_pos = checkPosition_(pos);
+    if (index_pos == size_) return &emplace_back(std::forward<Args>(args)...);
+    value_type value(std::forward<Args>(args)...);
+    Ops::fillGap(*this, index_pos, 1, [&value](pointer gap, size_type) {
+      ::new (static_cast<void *>(gap)) value_type(std::move(value));
+    });
+    return data_ + index_pos;
+  }
+
+  void erase(iterator pos) {
+    if (pos == end()) {
+      throw std::length_error("Pos must point to vector element");
+    }
+    erase(pos, pos + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type from = checkPosition_(first);
+    size_type to = checkPosition_(last);
+    if (from > to) {
+      throw std::length_error("Invalid erase range");
+    }
+    if (from != to) {
+      std::move(data_ + to, data_ + size_, data_ + from);
+      std::destroy(data_ + size_ - (to - from), data_ + size_);
+      size_ -= to - from;
+    }
+    return data_ + from;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      // args may refer to an element that growing moves away.
+      value_type value(std::forward<Args>(args)...);
+      reallocate_(Ops::nextCapacity(*this));
+      ::new (static_cast<void *>(data_ + size_)) value_type(std::move(value));
+    } else {
+      ::new (static_cast<void *>(data_ + size_))
+          value_type(std::forward<Args>(args)...);
+    }
+    return data_[size_++];
+  }
+
+  void pop_back() {
+    if (size_ == 0) {
+      throw std::length_error("Cant pop_back from zero length vector");
+    }
+    std::destroy_at(data_ + size_ - 1);
+    size_--;
+  }
+
+  // Two heap vectors swap buffers; otherwise the elements are moved through
+  // a temporary.
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    if (this == &other) return;
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+    } else {
+      small_vector tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    }
+  }
+
+  template <typename... Args,
+            typename = enable_if_constructible_t<value_type, Args...>>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    size_type last_pos = Ops::insertMany(*this, checkPosition_(pos),
+                                         std::forward<Args>(args)...);
+    return data_ + last_pos;
+  }
+
+  template <typename... Args,
+            typename = enable_if_constructible_t<value_type, Args...>>
+  void insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+  }
+
+ private:
+  pointer data_;
+  size_type size_;
+  size_type capacity_;
+  alignas(value_type) unsigned char buffer_[N * sizeof(value_type)];
+
+  pointer inline_() noexcept { return reinterpret_cast<pointer>(buffer_); }
+  const_pointer inline_() const noexcept {
+    return reinterpret_cast<const_pointer>(buffer_);
+  }
+
+  void checkIndex_(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+  }
+
+  size_type checkPosition_(const_pointer pos) const {
+    if (pos < data_ || pos > data_ + size_) {
+      throw std::length_error("Pos must point to vector element");
+    }
+    return pos - data_;
+  }
+
+  friend struct vector_detail::Ops;
+
+  // Same allocation scheme as s21::vector: trivially copyable elements use
+  // the C allocator, so that growing on the heap can use realloc.
+  static constexpr bool kRealloc =
+      vector_detail::kUseRealloc<value_type, std::allocator<value_type>>;
+
+  static pointer allocate_(size_type n) {
+    if constexpr (kRealloc) {
+      void *p = std::malloc(n * sizeof(value_type));
+      if (p == nullptr) throw std::bad_alloc();
+      return static_cast<pointer>(p);
+    } else {
+      return std::allocator<value_type>().allocate(n);
+    }
+  }
+
+  static void deallocate_(pointer p, size_type n) noexcept {
+    if constexpr (kRealloc) {
+      std::free(p);
+    } else {
+      std::allocator<value_type>().deallocate(p, n);
+    }
+  }
+
+  // Moves the elements to a buffer of new_capacity >= size() slots, which
+  // is the inline one when it is large enough.
+  void reallocate_(size_type new_capacity) {
+    bool to_inline = new_capacity <= N;
+    if (to_inline && is_inline()) return;
+    if constexpr (kRealloc) {
+      if (!to_inline && !is_inline()) {
+        void *p = std::realloc(data_, new_capacity * sizeof(value_type));
+        if (p == nullptr) throw std::bad_alloc();
+        data_ = static_cast<pointer>(p);
+        capacity_ = new_capacity;
+        return;
+      }
+    }
+    pointer tmp = to_inline ? inline_() : allocate_(new_capacity);
+    try {
+      vector_detail::relocate(data_, data_ + size_, tmp);
+    } catch (...) {
+      if (!to_inline) deallocate_(tmp, new_capacity);
+      throw;
+    }
+    replaceBuffer_(tmp, to_inline ? N : new_capacity);
+  }
+
+  // Destroys the elements, which were relocated to tmp, and adopts tmp as
+  // the buffer.
+  void replaceBuffer_(pointer tmp, size_type new_capacity) noexcept {
+    std::destroy(data_, data_ + size_);
+    if (!is_inline()) deallocate_(data_, capacity_);
+    data_ = tmp;
+    capacity_ = new_capacity;
+  }
+
+  // Takes the elements of v, which this vector must not hold any of: a heap
+  // buffer is handed over, inline elements are moved. v is left empty.
+  void takeFrom_(small_vector &v) {
+    if (v.is_inline()) {
+      vector_detail::relocate(v.data_, v.data_ + v.size_, data_);
+      size_ = v.size_;
+      v.clear();
+    } else {
+      data_ = v.data_;
+      size_ = v.size_;
+      capacity_ = v.capacity_;
+      v.data_ = v.inline_();
+      v.size_ = 0;
+      v.capacity_ = N;
+    }
+  }
+
+  // Destroys the elements and returns to the empty inline state.
+  void setInline_() noexcept {
+    std::destroy(data_, data_ + size_);
+    if (!is_inline()) deallocate_(data_, capacity_);
+    data_ = inline_();
+    size_ = 0;
+    capacity_ = N;
+  }
+};
+}  // namespace s21
+
+#endif  // SRC_S21_SMALL_VECTOR_H_
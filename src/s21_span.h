@@ -0,0 +1,233 @@
+#ifndef SRC_S21_SPAN_H_
+#define SRC_S21_SPAN_H_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+#include "s21_utility.h"
+
+namespace s21 {
+inline constexpr size_t dynamic_extent = std::numeric_limits<size_t>::max();
+
+template <typename T, size_t Extent = dynamic_extent>
+class span;
+
+// Size of a span: nothing for a static extent, a count for a dynamic one.
+template <size_t Extent>
+class spanExtent {
+ public:
+  constexpr explicit spanExtent(size_t) noexcept {}
+  constexpr size_t size() const noexcept { return Extent; }
+};
+
+template <>
+class spanExtent<dynamic_extent> {
+ public:
+  constexpr explicit spanExtent(size_t size) noexcept : size_(size) {}
+  constexpr size_t size() const noexcept { return size_; }
+
+ private:
+  size_t size_;
+};
+
+// Non-owning view of a contiguous sequence: a pointer plus, for a dynamic
+// extent, a count. Copying or slicing a span never touches the elements or
+// allocates. Spans do not keep the viewed storage alive, and growing the
+// vector they were taken from invalidates them like its iterators. Bounds
+// are checked only in debug builds.
+template <typename T, size_t Extent>
+class span : private spanExtent<Extent> {
+  template <typename U>
+  using enable_if_convertible_t =
+      std::enable_if_t<std::is_convertible<U (*)[], T (*)[]>::value>;
+
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+
+  static constexpr size_type extent = Extent;
+
+  template <size_t E = Extent,
+            typename = std::enable_if_t<E == 0 || E == dynamic_extent>>
+  constexpr span() noexcept : spanExtent<Extent>(0), data_(nullptr) {}
+
+  constexpr span(pointer first, size_type count) noexcept
+      : spanExtent<Extent>(count), data_(first) {
+    S21_CONTAINERS_ASSERT(Extent == dynamic_extent || count == Extent,
+                          "span size does not match its extent");
+  }
+
+  // A template on the end type, as in std::span, so that span(p, 0) picks
+  // the count constructor instead of being ambiguous.
+  template <typename End,
+            typename = std::enable_if_t<
+                std::is_convertible<End, pointer>::value &&
+                !std::is_convertible<End, size_type>::value>>
+  constexpr span(pointer first, End last) noexcept
+      : span(first, static_cast<size_type>(static_cast<pointer>(last) -
+                                           first)) {}
+
+  template <size_t N, typename = std::enable_if_t<Extent == dynamic_extent ||
+                                                  N == Extent>>
+  constexpr span(element_type (&items)[N]) noexcept : span(items, N) {}
+
+  template <typename U, size_t N,
+            typename = std::enable_if_t<Extent == dynamic_extent ||
+                                        N == Extent>,
+            typename = enable_if_convertible_t<U>>
+  constexpr span(std::array<U, N> &items) noexcept
+      : span(items.data(), N) {}
+
+  template <typename U, size_t N,
+            typename = std::enable_if_t<Extent == dynamic_extent ||
+                                        N == Extent>,
+            typename = enable_if_convertible_t<const U>>
+  constexpr span(const std::array<U, N> &items) noexcept
+      : span(items.data(), N) {}
+
+  // From a span of a convertible element type, e.g. span<T> to
+  // span<const T>, or of a static extent to a dynamic one.
+  template <typename U, size_t N,
+            std::enable_if_t<Extent == dynamic_extent || N == Extent, int> = 0,
+            typename = enable_if_convertible_t<U>>
+  constexpr span(const span<U, N> &other) noexcept
+      : span(other.data(), other.size()) {}
+
+  // A dynamic extent becomes a static one only explicitly: the sizes have
+  // to match, which is checked in debug builds only.
+  template <typename U, size_t N,
+            std::enable_if_t<Extent != dynamic_extent && N == dynamic_extent,
+                             int> = 0,
+            typename = enable_if_convertible_t<U>>
+  constexpr explicit span(const span<U, N> &other) noexcept
+      : span(other.data(), other.size()) {}
+
+  constexpr span(const span &other) noexcept = default;
+  constexpr span &operator=(const span &other) noexcept = default;
+
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size(); }
+
+  constexpr reference front() const noexcept {
+    S21_CONTAINERS_ASSERT(size() > 0, "front() of an empty span");
+    return data_[0];
+  }
+
+  constexpr reference back() const noexcept {
+    S21_CONTAINERS_ASSERT(size() > 0, "back() of an empty span");
+    return data_[size() - 1];
+  }
+
+  constexpr reference operator[](size_type pos) const noexcept {
+    S21_CONTAINERS_ASSERT(pos < size(), "span index out of range");
+    return data_[pos];
+  }
+
+  constexpr pointer data() const noexcept { return data_; }
+
+  constexpr size_type size() const noexcept {
+    return spanExtent<Extent>::size();
+  }
+
+  constexpr size_type size_bytes() const noexcept {
+    return size() * sizeof(element_type);
+  }
+
+  constexpr bool empty() const noexcept { return size() == 0; }
+
+  template <size_t Count>
+  constexpr span<T, Count> first() const noexcept {
+    static_assert(Extent == dynamic_extent || Count <= Extent,
+                  "span::first beyond the extent");
+    S21_CONTAINERS_ASSERT(Count <= size(), "span::first beyond the size");
+    return span<T, Count>(data_, Count);
+  }
+
+  constexpr span<T> first(size_type count) const noexcept {
+    S21_CONTAINERS_ASSERT(count <= size(), "span::first beyond the size");
+    return span<T>(data_, count);
+  }
+
+  template <size_t Count>
+  constexpr span<T, Count> last() const noexcept {
+    static_assert(Extent == dynamic_extent || Count <= Extent,
+                  "span::last beyond the extent");
+    S21_CONTAINERS_ASSERT(Count <= size(), "span::last beyond the size");
+    return span<T, Count>(data_ + size() - Count, Count);
+  }
+
+  constexpr span<T> last(size_type count) const noexcept {
+    S21_CONTAINERS_ASSERT(count <= size(), "span::last beyond the size");
+    return span<T>(data_ + size() - count, count);
+  }
+
+  // Extent of subspan<Offset, Count>(): Count when given, what is left of
+  // a static extent otherwise.
+  template <size_t Offset, size_t Count>
+  static constexpr size_t subspanExtent =
+      Count != dynamic_extent
+          ? Count
+          : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent);
+
+  template <size_t Offset, size_t Count = dynamic_extent>
+  constexpr span<T, subspanExtent<Offset, Count>> subspan() const noexcept {
+    static_assert(Extent == dynamic_extent ||
+                      (Offset <= Extent &&
+                       (Count == dynamic_extent || Count <= Extent - Offset)),
+                  "span::subspan beyond the extent");
+    S21_CONTAINERS_ASSERT(
+        Offset <= size() && (Count == dynamic_extent ||
+                             Count <= size() - Offset),
+        "span::subspan beyond the size");
+    return span<T, subspanExtent<Offset, Count>>(
+        data_ + Offset, Count == dynamic_extent ? size() - Offset : Count);
+  }
+
+  constexpr span<T> subspan(size_type offset,
+                            size_type count = dynamic_extent) const noexcept {
+    S21_CONTAINERS_ASSERT(
+        offset <= size() &&
+            (count == dynamic_extent || count <= size() - offset),
+        "span::subspan beyond the size");
+    return span<T>(data_ + offset,
+                   count == dynamic_extent ? size() - offset : count);
+  }
+
+ private:
+  pointer data_;
+};
+
+template <typename T, size_t N>
+span(T (&)[N]) -> span<T, N>;
+
+template <typename T, size_t N>
+span(std::array<T, N> &) -> span<T, N>;
+
+template <typename T, size_t N>
+span(const std::array<T, N> &) -> span<const T, N>;
+
+// The bytes of the viewed elements, e.g. for parsers and hashing.
+template <typename T, size_t N>
+span<const std::byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>
+as_bytes(span<T, N> s) noexcept {
+  return {reinterpret_cast<const std::byte *>(s.data()), s.size_bytes()};
+}
+
+template <typename T, size_t N,
+          typename = std::enable_if_t<!std::is_const<T>::value>>
+span<std::byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>
+as_writable_bytes(span<T, N> s) noexcept {
+  return {reinterpret_cast<std::byte *>(s.data()), s.size_bytes()};
+}
+}  // namespace s21
+
+#endif  // SRC_S21_SPAN_H_
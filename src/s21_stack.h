@@ -37,7 +37,7 @@ class stack {
 
   template <typename... Args>
   void insert_many_front(Args&&... args) {
-    container_.insert_many_front(args...);
+    container_.insert_many_front(std::forward<Args>(args)...);
   }
 
  private:
@@ -0,0 +1,188 @@
+#ifndef SRC_S21_UNORDERED_MAP_H_
+#define SRC_S21_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <tuple>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+  // Hash and equality of stored pairs by key, and of pairs against bare
+  // keys for lookups.
+  struct mapHash : Hash {
+    mapHash() = default;
+    explicit mapHash(const Hash& hash) : Hash(hash) {}
+
+    std::size_t operator()(const value_type& a) const {
+      return Hash::operator()(a.first);
+    }
+
+    template <typename K>
+    std::size_t operator()(const K& key) const {
+      return Hash::operator()(key);
+    }
+  };
+
+  struct mapEqual : KeyEqual {
+    mapEqual() = default;
+    explicit mapEqual(const KeyEqual& equal) : KeyEqual(equal) {}
+
+    bool operator()(const value_type& a, const value_type& b) const {
+      return KeyEqual::operator()(a.first, b.first);
+    }
+
+    template <typename K>
+    bool operator()(const value_type& a, const K& key) const {
+      return KeyEqual::operator()(a.first, key);
+    }
+  };
+
+  using table_type =
+      HashTable<key_type, value_type, mapHash, mapEqual, Allocator>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+  unordered_map() = default;
+
+  explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : table_(bucket_count, mapHash(hash), mapEqual(equal), alloc) {}
+
+  unordered_map(std::initializer_list<value_type> const& items) {
+    table_.reserve(items.size());
+    for (auto const& item : items) insert(item);
+  }
+
+  unordered_map(const unordered_map& m) = default;
+  unordered_map(unordered_map&& m) noexcept = default;
+  unordered_map& operator=(const unordered_map& m) = default;
+  unordered_map& operator=(unordered_map&& m) = default;
+  ~unordered_map() = default;
+
+  T& at(const Key& key) { return atImpl(key); }
+
+  template <typename K, typename = enable_transparent_t<Hash, K>,
+            typename = enable_transparent_t<KeyEqual, K>>
+  T& at(const K& key) {
+    return atImpl(key);
+  }
+
+  T& operator[](const Key& key) {
+    return table_
+        .findOrEmplace(key, std::piecewise_construct,
+                       std::forward_as_tuple(key), std::forward_as_tuple())
+        .first->second;
+  }
+
+  iterator begin() noexcept { return table_.begin(); }
+  iterator end() noexcept { return table_.end(); }
+  const_iterator cbegin() const noexcept { return table_.begin(); }
+  const_iterator cend() const noexcept { return table_.end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return table_.insert(std::move(value));
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return table_.insert(value_type{key, obj});
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    std::pair<iterator, bool> result = insert(key, obj);
+    if (result.second == false) result.first->second = obj;
+    return result;
+  }
+
+  void erase(iterator pos) { table_.erase(pos); }
+  size_type erase(const Key& key) { return table_.eraseKey(key); }
+
+  void swap(unordered_map& other) noexcept { table_.swap(other.table_); }
+  void clear() noexcept { table_.clear(); }
+
+  // Moves over the elements whose keys are missing here; the rest stay in
+  // other.
+  void merge(unordered_map& other) {
+    for (auto it = other.begin(); it != other.end(); ++it) {
+      if (!contains(it->first)) {
+        insert(std::move(*it));
+        other.erase(it);
+      }
+    }
+  }
+
+  iterator find(const Key& key) { return table_.find(key); }
+
+  template <typename K, typename = enable_transparent_t<Hash, K>,
+            typename = enable_transparent_t<KeyEqual, K>>
+  iterator find(const K& key) {
+    return table_.find(key);
+  }
+
+  bool contains(const Key& key) const { return table_.contains(key); }
+
+  template <typename K, typename = enable_transparent_t<Hash, K>,
+            typename = enable_transparent_t<KeyEqual, K>>
+  bool contains(const K& key) const {
+    return table_.contains(key);
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  void reserve(size_type count) { table_.reserve(count); }
+  size_type bucket_count() const noexcept { return table_.capacity(); }
+
+  float load_factor() const noexcept {
+    return bucket_count() ? static_cast<float>(size()) / bucket_count() : 0;
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> result;
+    table_.reserve(size() + sizeof...(Args));
+    (result.push_back(insert(std::forward<Args>(args))), ...);
+    return result;
+  }
+
+ private:
+  template <typename K>
+  T& atImpl(const K& key) {
+    iterator it = table_.find(key);
+    if (it == end()) throw std::out_of_range("no key found");
+    return it->second;
+  }
+
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_UNORDERED_MAP_H_
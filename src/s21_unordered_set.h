@@ -0,0 +1,123 @@
+#ifndef SRC_S21_UNORDERED_SET_H_
+#define SRC_S21_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "s21_hash_table.h"
+
+namespace s21 {
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+class unordered_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+  using table_type = HashTable<Key, Key, Hash, KeyEqual, Allocator>;
+  using iterator = typename table_type::const_iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+  unordered_set() = default;
+
+  explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual(),
+                         const Allocator& alloc = Allocator())
+      : table_(bucket_count, hash, equal, alloc) {}
+
+  unordered_set(std::initializer_list<value_type> const& items) {
+    table_.reserve(items.size());
+    for (auto const& item : items) insert(item);
+  }
+
+  unordered_set(const unordered_set& s) = default;
+  unordered_set(unordered_set&& s) noexcept = default;
+  unordered_set& operator=(const unordered_set& s) = default;
+  unordered_set& operator=(unordered_set&& s) = default;
+  ~unordered_set() = default;
+
+  iterator begin() const noexcept { return table_.begin(); }
+  iterator end() const noexcept { return table_.end(); }
+  const_iterator cbegin() const noexcept { return table_.begin(); }
+  const_iterator cend() const noexcept { return table_.end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  size_type max_size() const noexcept { return table_.max_size(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return table_.insert(std::move(value));
+  }
+
+  void erase(iterator pos) { table_.erase(pos); }
+  size_type erase(const Key& key) { return table_.eraseKey(key); }
+
+  void swap(unordered_set& other) noexcept { table_.swap(other.table_); }
+  void clear() noexcept { table_.clear(); }
+
+  // Moves over the elements whose keys are missing here; the rest stay in
+  // other.
+  void merge(unordered_set& other) {
+    for (auto it = other.table_.begin(); it != other.table_.end(); ++it) {
+      if (!contains(*it)) {
+        insert(std::move(*it));
+        other.table_.erase(it);
+      }
+    }
+  }
+
+  iterator find(const Key& key) const { return table_.find(key); }
+
+  template <typename K, typename = enable_transparent_t<Hash, K>,
+            typename = enable_transparent_t<KeyEqual, K>>
+  iterator find(const K& key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const Key& key) const { return table_.contains(key); }
+
+  template <typename K, typename = enable_transparent_t<Hash, K>,
+            typename = enable_transparent_t<KeyEqual, K>>
+  bool contains(const K& key) const {
+    return table_.contains(key);
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  void reserve(size_type count) { table_.reserve(count); }
+  size_type bucket_count() const noexcept { return table_.capacity(); }
+
+  float load_factor() const noexcept {
+    return bucket_count() ? static_cast<float>(size()) / bucket_count() : 0;
+  }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    std::vector<std::pair<iterator, bool>> result;
+    table_.reserve(size() + sizeof...(Args));
+    (result.push_back(insert(std::forward<Args>(args))), ...);
+    return result;
+  }
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_UNORDERED_SET_H_
@@ -0,0 +1,83 @@
+#ifndef SRC_S21_UTILITY_H_
+#define SRC_S21_UTILITY_H_
+
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <type_traits>
+
+// Preconditions of unchecked operations (valid index, non-empty container,
+// iterator within range) are verified only when S21_CONTAINERS_DEBUG is
+// defined; otherwise the checks compile to nothing. Unlike assert() they do
+// not depend on NDEBUG.
+#ifdef S21_CONTAINERS_DEBUG
+#define S21_CONTAINERS_ASSERT(cond, msg) \
+  ((cond) ? (void)0 : ::s21::assertFail(#cond, msg, __FILE__, __LINE__))
+#else
+#define S21_CONTAINERS_ASSERT(cond, msg) ((void)0)
+#endif
+
+namespace s21 {
+[[noreturn]] inline void assertFail(const char *cond, const char *msg,
+                                    const char *file, int line) {
+  std::fprintf(stderr, "%s:%d: s21 container check '%s' failed: %s\n", file,
+               line, cond, msg);
+  std::abort();
+}
+
+template <typename Compare, typename K, typename = void>
+struct is_transparent_lookup : std::false_type {};
+
+template <typename Compare, typename K>
+struct is_transparent_lookup<Compare, K,
+                             std::void_t<typename Compare::is_transparent>>
+    : std::true_type {};
+
+// Gates the heterogeneous lookup overloads of the containers on the
+// comparator (or hasher) declaring is_transparent, the same way std::map
+// does.
+template <typename Compare, typename K>
+using enable_transparent_t =
+    std::enable_if_t<is_transparent_lookup<Compare, K>::value>;
+
+// Keeps the (first, last) range overloads of the containers away from
+// calls with two values of the same non-iterator type.
+template <typename It>
+using enable_if_iterator_t = std::enable_if_t<std::is_base_of<
+    std::input_iterator_tag,
+    typename std::iterator_traits<It>::iterator_category>::value>;
+
+// Keeps insert_many away from arguments T cannot be direct-initialised
+// from, such as a pointer for an integer T.
+template <typename T, typename... Args>
+using enable_if_constructible_t = std::enable_if_t<
+    std::conjunction<std::is_constructible<T, Args &&>...>::value>;
+
+// Holds a function object as a base class when it is empty, so stateless
+// comparators add nothing to the size of the owner.
+template <typename T,
+          bool = std::is_empty<T>::value && !std::is_final<T>::value>
+class EboStorage : private T {
+ public:
+  EboStorage() = default;
+  explicit EboStorage(const T &value) : T(value) {}
+
+  T &get() noexcept { return *this; }
+  const T &get() const noexcept { return *this; }
+};
+
+template <typename T>
+class EboStorage<T, false> {
+ public:
+  EboStorage() = default;
+  explicit EboStorage(const T &value) : value_(value) {}
+
+  T &get() noexcept { return value_; }
+  const T &get() const noexcept { return value_; }
+
+ private:
+  T value_;
+};
+}  // namespace s21
+
+#endif  // SRC_S21_UTILITY_H_
@@ -4,110 +4,268 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_simd.h"
+#include "s21_span.h"
+#include "s21_utility.h"
+#include "s21_vector_detail.h"
 
 namespace s21 {
+// Growth policy of s21::vector<T>: the first append allocates kMinCapacity
+// slots, a full vector grows to capacity * kNumerator / kDenominator.
+// Specialise it to trade memory for reallocations, e.g. 3 / 2 for 1.5x. The
+// default minimum fills a cache line and is a power of two, so doubling from
+// it reaches the same capacities as doubling from one.
 template <typename T>
-class vector {
+struct vector_growth {
+  static constexpr size_t floorPow2(size_t n) {
+    size_t p = 1;
+    while (p * 2 <= n) p *= 2;
+    return p;
+  }
+
+  static constexpr size_t kNumerator = 2;
+  static constexpr size_t kDenominator = 1;
+  static constexpr size_t kMinCapacity = floorPow2(64 / sizeof(T));
+};
+
+// Elements live in raw storage: slots between size() and capacity() hold no
+// object, elements are constructed in place and destroyed when removed.
+// Storage comes from Allocator through std::allocator_traits, which also
+// decides whether the allocator follows the elements on copy, move and
+// swap; the elements themselves are placement-constructed, so nested
+// allocator-aware types do not inherit the allocator.
+template <typename T, typename Allocator = std::allocator<T>>
+class vector : private EboStorage<Allocator> {
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using Ops = vector_detail::Ops;
+  static_assert(std::is_same<typename alloc_traits::pointer, T *>::value,
+                "s21::vector needs an allocator with raw pointers");
+
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using allocator_type = Allocator;
+#ifdef S21_CONTAINERS_DEBUG
+  template <bool Const>
+  class checkedIterator;
+  using iterator = checkedIterator<false>;
+  using const_iterator = checkedIterator<true>;
+#else
   using iterator = T *;
   using const_iterator = const T *;
-  using size_type = size_t;
+#endif
+
+  vector() noexcept(noexcept(Allocator())) : vector(Allocator()) {}
 
-  vector() : data_(nullptr), size_(0), capacity_(0) {}
+  explicit vector(const Allocator &alloc) noexcept
+      : EboStorage<Allocator>(alloc),
+        data_(nullptr),
+        size_(0),
+        capacity_(0) {}
 
-  explicit vector(size_type n) : size_(n), capacity_(n) {
+  explicit vector(size_type n, const Allocator &alloc = Allocator())
+      : vector(alloc) {
     if (n > 0) {
-      data_ = new value_type[n];
-      std::fill(begin(), end(), 0);
-    } else {
-      data_ = nullptr;
+      allocateFor_(n, [&] { std::uninitialized_value_construct_n(data_, n); });
+    }
+  }
+
+  vector(size_type n, const_reference value,
+         const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    if (n > 0) {
+      allocateFor_(n, [&] {
+        if constexpr (simd::kVectorized<value_type>) {
+          simd::fill(data_, n, value);
+        } else {
+          std::uninitialized_fill_n(data_, n, value);
+        }
+      });
     }
   }
 
-  vector(std::initializer_list<value_type> const &items)
-      : data_(new value_type[items.size()]),
-        size_(items.size()),
-        capacity_(items.size()) {
-    std::copy(items.begin(), items.end(), data_);
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator())
+      : vector(alloc) {
+    if (items.size() > 0) {
+      allocateFor_(items.size(), [&] {
+        std::uninitialized_copy(items.begin(), items.end(), data_);
+      });
+    }
   }
 
   vector(const vector &v)
-      : data_(new value_type[v.capacity_]),
-        size_(v.size_),
-        capacity_(v.capacity_) {
-    std::copy(v.data_, v.data_ + size_, data_);
+      : vector(v, alloc_traits::select_on_container_copy_construction(
+                      v.alloc_())) {}
+
+  vector(const vector &v, const Allocator &alloc) : vector(alloc) {
+    if (v.size_ > 0) {
+      allocateFor_(v.size_, [&] {
+        std::uninitialized_copy(v.data_, v.data_ + v.size_, data_);
+      });
+    }
   }
 
-  vector(vector &&v) : data_(v.data_), size_(v.size_), capacity_(v.capacity_) {
-    v.data_ = nullptr;
-    v.size_ = 0;
-    v.capacity_ = 0;
+  vector(vector &&v) noexcept : vector(v.alloc_()) { stealFrom_(v); }
+
+  // Takes the buffer of v when alloc can free it, moves the elements one by
+  // one otherwise.
+  vector(vector &&v, const Allocator &alloc) : vector(alloc) {
+    if (alloc_() == v.alloc_()) {
+      stealFrom_(v);
+    } else if (v.size_ > 0) {
+      allocateFor_(v.size_, [&] {
+        std::uninitialized_move(v.data_, v.data_ + v.size_, data_);
+      });
+    }
   }
 
   ~vector() { setZero_(); }
 
-  vector &operator=(vector &&v) {
+  vector &operator=(vector &&v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
     if (this != &v) {
-      setZero_();
-      size_ = v.size_;
-      capacity_ = v.capacity_;
-      data_ = v.data_;
-      v.size_ = 0;
-      v.capacity_ = 0;
-      v.data_ = nullptr;
+      if (alloc_traits::propagate_on_container_move_assignment::value ||
+          alloc_() == v.alloc_()) {
+        setZero_();
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                          value) {
+          alloc_() = v.alloc_();
+        }
+        stealFrom_(v);
+      } else {
+        vector moved(std::move(v), alloc_());
+        swapBuffers_(moved);
+      }
     }
     return *this;
   }
 
   vector &operator=(const vector &v) {
     if (this != &v) {
-      setZero_();
-      size_ = v.size_;
-      capacity_ = v.capacity_;
-      data_ = nullptr;
-      if (size_ > 0) {
-        data_ = new value_type[capacity_];
-        std::copy(v.data_, v.data_ + size_, data_);
+      if constexpr (alloc_traits::propagate_on_container_copy_assignment::
+                        value) {
+        if (alloc_() != v.alloc_()) setZero_();
+        alloc_() = v.alloc_();
       }
+      vector copy(v, alloc_());
+      swapBuffers_(copy);
     }
     return *this;
   }
 
-  reference at(size_type pos) const {
-    if (pos >= size_) {
-      throw std::out_of_range("Index out of range");
+  allocator_type get_allocator() const noexcept { return alloc_(); }
+
+  // Replaces the contents, reusing the buffer when it is large enough. The
+  // new elements must not be elements of this vector, except value.
+  void assign(size_type count, const_reference value) {
+    value_type copy(value);
+    clear();
+    insert(end(), count, copy);
+  }
+
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  void assign(InputIt first, InputIt last) {
+    clear();
+    insert(end(), first, last);
+  }
+
+  void assign(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+  }
+
+  // The viewed elements may be elements of this vector.
+  void assign(span<const value_type> values) {
+    if (overlaps_(values)) {
+      vector copy(alloc_());
+      copy.insert(copy.end(), values.begin(), values.end());
+      swapBuffers_(copy);
+    } else {
+      assign(values.begin(), values.end());
     }
+  }
+
+  // Views of the elements, e.g. span<const T> from a vector<T>.
+  template <typename U, typename = std::enable_if_t<
+                            std::is_convertible<T (*)[], U (*)[]>::value>>
+  operator span<U>() noexcept {
+    return span<U>(data_, size_);
+  }
+
+  template <typename U, typename = std::enable_if_t<std::is_convertible<
+                            const T (*)[], U (*)[]>::value>>
+  operator span<U>() const noexcept {
+    return span<U>(data_, size_);
+  }
+
+  reference at(size_type pos) {
+    checkIndex_(pos);
     return data_[pos];
   }
 
-  reference operator[](size_type pos) { return at(pos); }
-  const_reference operator[](size_type pos) const { return at(pos); }
+  const_reference at(size_type pos) const {
+    checkIndex_(pos);
+    return data_[pos];
+  }
 
-  const_reference front() const {
-    if (size_ == 0) {
-      throw std::logic_error("Vector size is zero");
-    }
+  // Unchecked; out of range indices are caught only in debug builds.
+  reference operator[](size_type pos) noexcept {
+    S21_CONTAINERS_ASSERT(pos < size_, "vector index out of range");
+    return data_[pos];
+  }
+
+  const_reference operator[](size_type pos) const noexcept {
+    S21_CONTAINERS_ASSERT(pos < size_, "vector index out of range");
+    return data_[pos];
+  }
+
+  reference front() noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "front() of an empty vector");
     return data_[0];
   }
 
-  const_reference back() const {
-    if (size_ == 0) {
-      throw std::logic_error("Vector size is zero");
-    }
+  const_reference front() const noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "front() of an empty vector");
+    return data_[0];
+  }
+
+  reference back() noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "back() of an empty vector");
     return data_[size_ - 1];
   }
 
-  iterator data() noexcept { return &data_[0]; }
+  const_reference back() const noexcept {
+    S21_CONTAINERS_ASSERT(size_ > 0, "back() of an empty vector");
+    return data_[size_ - 1];
+  }
+
+  pointer data() noexcept { return data_; }
+  const_pointer data() const noexcept { return data_; }
 
-  iterator begin() noexcept { return &data_[0]; }
+  iterator begin() noexcept { return makeIterator_(data_); }
+  const_iterator begin() const noexcept { return makeIterator_(data_); }
 
-  iterator end() noexcept { return &data_[size_]; }
+  iterator end() noexcept { return makeIterator_(data_ + size_); }
+  const_iterator end() const noexcept { return makeIterator_(data_ + size_); }
 
   bool empty() const noexcept { return size_ == 0; }
 
@@ -117,102 +275,543 @@ class vector {
     return std::numeric_limits<size_type>::max() / sizeof(value_type);
   }
 
+  // Allocates once and constructs nothing.
   void reserve(size_type size) {
-    if (size > capacity_) {
-      iterator tmp = data_;
-      data_ = new value_type[size];
-      std::copy(tmp, tmp + size_, data_);
-      delete[] tmp;
-      capacity_ = size;
-    }
+    if (size > capacity_) reallocate_(size);
+  }
+
+  // Sets the capacity to exactly max(size, size()), growing or shrinking,
+  // regardless of the growth policy.
+  void reserve_exact(size_type size) {
+    size = std::max(size, size_);
+    if (size != capacity_) reallocate_(size);
   }
 
   size_type capacity() const noexcept { return capacity_; }
 
   void shrink_to_fit() {
-    if (size_ < capacity_) {
-      iterator tmp = new value_type[size_];
-      std::copy(data_, data_ + size_, tmp);
-      delete[] data_;
-      data_ = tmp;
-      capacity_ = size_;
+    if (size_ < capacity_) reallocate_(size_);
+  }
+
+  void clear() noexcept {
+    std::destroy(data_, data_ + size_);
+    size_ = 0;
+  }
+
+  // New elements are value-initialised.
+  void resize(size_type count) {
+    Ops::resizeWith(*this, count, [](pointer first, size_type n) {
+      std::uninitialized_value_construct_n(first, n);
+    });
+  }
+
+  void resize(size_type count, const_reference value) {
+    if (count > capacity_) {
+      // value may be an element of this vector.
+      value_type copy(value);
+      Ops::resizeWith(*this, count, [&copy](pointer first, size_type n) {
+        std::uninitialized_fill_n(first, n, copy);
+      });
+    } else {
+      Ops::resizeWith(*this, count, [&value](pointer first, size_type n) {
+        std::uninitialized_fill_n(first, n, value);
+      });
     }
   }
 
-  void clear() noexcept { size_ = 0; }
+  // New elements are default-initialised, which leaves arithmetic values
+  // indeterminate: for buffers the caller fills right away.
+  void resize_for_overwrite(size_type count) {
+    Ops::resizeWith(*this, count, [](pointer first, size_type n) {
+      std::uninitialized_default_construct_n(first, n);
+    });
+  }
 
-  iterator insert(iterator pos, const_reference value) {
-    if (pos < begin() || pos > end()) {
-      throw std::length_error("Pos must point to vector element");
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  // Inserts count copies of value with a single shift of the tail.
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value) {
+    size_type index_pos = checkPosition_(base_(pos));
+    // value may be an element of this vector.
+    value_type copy(value);
+    Ops::fillGap(*this, index_pos, count, [&copy](pointer gap, size_type n) {
+      std::uninitialized_fill_n(gap, n, copy);
+    });
+    return begin() + index_pos;
+  }
+
+  // Inserts [first, last), which must not point into this vector. Forward
+  // ranges shift the tail once; single-pass input is appended and rotated
+  // into place.
+  template <typename InputIt, typename = enable_if_iterator_t<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index_pos = checkPosition_(base_(pos));
+    Ops::insertRange(*this, index_pos, first, last);
+    return begin() + index_pos;
+  }
+
+  // Inserts the viewed elements. They may be elements of this vector, e.g.
+  // v.insert(v.end(), v), and are then copied out before anything moves.
+  iterator insert(const_iterator pos, span<const value_type> values) {
+    if (overlaps_(values)) {
+      vector copy(alloc_());
+      copy.insert(copy.end(), values.begin(), values.end());
+      return insert(pos, std::make_move_iterator(copy.data_),
+                    std::make_move_iterator(copy.data_ + copy.size_));
     }
-    size_type index_pos = pos - begin();
+    return insert(pos, values.begin(), values.end());
+  }
+
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(end(), std::begin(range), std::end(range));
+  }
+
+  // The new element is built before anything moves, so args may refer to
+  // elements of this vector.
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index_pos = checkPosition_(base_(pos));
     if (size_ == capacity_) {
-      reserve(capacity_ * 2);
+      return makeIterator_(
+          reallocInsert_(index_pos, std::forward<Args>(args)...));
     }
-    iterator new_pos = begin() + index_pos;
-    for (iterator iter = end(); iter > new_pos; iter--) {
-      *iter = *(iter - 1);
+    pointer new_pos = data_ + index_pos;
+    if (new_pos == data_ + size_) {
+      ::new (static_cast<void *>(new_pos))
+          value_type(std::forward<Args>(args)...);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      pointer last = data_ + size_;
+      ::new (static_cast<void *>(last)) value_type(std::move(last[-1]));
+      std::move_backward(new_pos, last - 1, last);
+      *new_pos = std::move(value);
     }
-    *new_pos = value;
     size_++;
-    return new_pos;
+    return makeIterator_(new_pos);
   }
 
   void erase(iterator pos) {
-    if (pos < begin() || pos > end()) {
+    if (base_(pos) == data_ + size_) {
       throw std::length_error("Pos must point to vector element");
     }
-    for (iterator iter = pos; iter < end() - 1; iter++) {
-      *iter = *(iter + 1);
+    erase(pos, pos + 1);
+  }
+
+  // Removes [first, last) with a single shift of the tail.
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type from = checkPosition_(base_(first));
+    size_type to = checkPosition_(base_(last));
+    if (from > to) {
+      throw std::length_error("Invalid erase range");
     }
-    size_--;
+    if (from != to) {
+      if constexpr (std::is_trivially_copyable<value_type>::value) {
+        std::memmove(static_cast<void *>(data_ + from), data_ + to,
+                     (size_ - to) * sizeof(value_type));
+      } else {
+        std::move(data_ + to, data_ + size_, data_ + from);
+        std::destroy(data_ + size_ - (to - from), data_ + size_);
+      }
+      size_ -= to - from;
+    }
+    return begin() + from;
   }
 
-  void push_back(const_reference value) { insert(end(), value); }
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      return *reallocInsert_(size_, std::forward<Args>(args)...);
+    }
+    ::new (static_cast<void *>(data_ + size_))
+        value_type(std::forward<Args>(args)...);
+    return data_[size_++];
+  }
 
   void pop_back() {
     if (size_ == 0) {
       throw std::length_error("Cant pop_back from zero length vector");
     }
+    std::destroy_at(data_ + size_ - 1);
     size_--;
   }
 
-  void swap(vector &other) {
-    std::swap(other.size_, size_);
-    std::swap(other.capacity_, capacity_);
-    std::swap(other.data_, data_);
+  // Allocators are exchanged only when they propagate on swap; otherwise
+  // they must compare equal.
+  void swap(vector &other) noexcept {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(alloc_(), other.alloc_());
+    }
+    swapBuffers_(other);
   }
 
-  template <typename... Args>
+  // Linear search, vectorised for int32_t, float and uint8_t.
+  iterator find(const_reference value) noexcept {
+    return makeIterator_(data_ + simd::find(data_, size_, value));
+  }
+
+  const_iterator find(const_reference value) const noexcept {
+    return makeIterator_(data_ + simd::find(data_, size_, value));
+  }
+
+  bool contains(const_reference value) const noexcept {
+    return simd::find(data_, size_, value) != size_;
+  }
+
+  // min() and max() throw std::out_of_range on an empty vector, like
+  // s21::array.
+  value_type min() const {
+    checkNotEmpty_();
+    return simd::min(data_, size_);
+  }
+
+  value_type max() const {
+    checkNotEmpty_();
+    return simd::max(data_, size_);
+  }
+
+  // Integers are summed in 64 bits, see simd_sum.
+  typename simd_sum<value_type>::type sum() const noexcept {
+    return simd::sum(data_, size_);
+  }
+
+  // Returns the last inserted element, or pos when args is empty. The
+  // elements are built first, so args may refer to elements of this vector,
+  // and then moved in with a single shift of the tail.
+  template <typename... Args,
+            typename = enable_if_constructible_t<value_type, Args...>>
   iterator insert_many(const_iterator pos, Args &&...args) {
-    auto args_v =
-        std::initializer_list<value_type>{std::forward<Args>(args)...};
-    iterator tmp_pos = (iterator)pos;
-    for (auto &i : args_v) {
-      tmp_pos = insert(tmp_pos, i) + 1;
-    }
-    return tmp_pos - 1;
+    size_type last_pos = Ops::insertMany(*this, checkPosition_(base_(pos)),
+                                         std::forward<Args>(args)...);
+    return begin() + last_pos;
   }
 
-  template <typename... Args>
+  template <typename... Args,
+            typename = enable_if_constructible_t<value_type, Args...>>
   void insert_many_back(Args &&...args) {
-    insert_many(end(), args...);
+    insert_many(end(), std::forward<Args>(args)...);
   }
 
  private:
-  iterator data_;
+  pointer data_;
   size_type size_;
   size_type capacity_;
 
-  void setZero_() {
-    if (data_ != nullptr) {
-      delete[] data_;
+  void checkIndex_(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("Index out of range");
+    }
+  }
+
+  void checkNotEmpty_() const {
+    if (size_ == 0) {
+      throw std::out_of_range("Empty vector has no min or max");
+    }
+  }
+
+  // Whether values views any element of this vector.
+  bool overlaps_(span<const value_type> values) const noexcept {
+    std::less<const_pointer> less;
+    return less(values.data(), data_ + size_) &&
+           less(data_, values.data() + values.size());
+  }
+
+  size_type checkPosition_(const_pointer pos) const {
+    if (pos < data_ || pos > data_ + size_) {
+      throw std::length_error("Pos must point to vector element");
+    }
+    return pos - data_;
+  }
+
+#ifdef S21_CONTAINERS_DEBUG
+  iterator makeIterator_(pointer p) noexcept { return iterator(this, p); }
+  const_iterator makeIterator_(const_pointer p) const noexcept {
+    return const_iterator(this, const_cast<pointer>(p));
+  }
+  static const_pointer base_(const_iterator it) noexcept { return it.ptr_; }
+#else
+  static iterator makeIterator_(pointer p) noexcept { return p; }
+  static const_iterator makeIterator_(const_pointer p) noexcept { return p; }
+  static const_pointer base_(const_iterator it) noexcept { return it; }
+#endif
+
+  Allocator &alloc_() noexcept { return this->get(); }
+  const Allocator &alloc_() const noexcept { return this->get(); }
+
+  friend struct vector_detail::Ops;
+
+  static constexpr bool kRealloc =
+      vector_detail::kUseRealloc<value_type, Allocator>;
+
+  pointer allocate_(size_type n) {
+    if (n == 0) return nullptr;
+    if constexpr (kRealloc) {
+      void *p = std::malloc(n * sizeof(value_type));
+      if (p == nullptr) throw std::bad_alloc();
+      return static_cast<pointer>(p);
+    } else {
+      return alloc_traits::allocate(alloc_(), n);
+    }
+  }
+
+  void deallocate_(pointer p, size_type n) noexcept {
+    if (p == nullptr) return;
+    if constexpr (kRealloc) {
+      std::free(p);
+    } else {
+      alloc_traits::deallocate(alloc_(), p, n);
+    }
+  }
+
+  // Gives an empty vector a buffer of n elements that construct fills.
+  template <typename Construct>
+  void allocateFor_(size_type n, Construct &&construct) {
+    data_ = allocate_(n);
+    try {
+      construct();
+    } catch (...) {
+      deallocate_(data_, n);
       data_ = nullptr;
+      throw;
+    }
+    size_ = n;
+    capacity_ = n;
+  }
+
+  void reallocate_(size_type new_capacity) {
+    if constexpr (kRealloc) {
+      if (new_capacity == 0) {
+        setZero_();
+        return;
+      }
+      void *p = std::realloc(data_, new_capacity * sizeof(value_type));
+      if (p == nullptr) throw std::bad_alloc();
+      data_ = static_cast<pointer>(p);
+    } else {
+      pointer tmp = allocate_(new_capacity);
+      try {
+        vector_detail::relocate(data_, data_ + size_, tmp);
+      } catch (...) {
+        deallocate_(tmp, new_capacity);
+        throw;
+      }
+      replaceBuffer_(tmp, new_capacity);
+      return;
+    }
+    capacity_ = new_capacity;
+  }
+
+  // Destroys the elements, which were relocated to tmp, and adopts tmp as
+  // the buffer.
+  void replaceBuffer_(pointer tmp, size_type new_capacity) noexcept {
+    std::destroy(data_, data_ + size_);
+    deallocate_(data_, capacity_);
+    data_ = tmp;
+    capacity_ = new_capacity;
+  }
+
+  // Grows into a new buffer, building the new element at index_pos first
+  // and relocating the old elements around it.
+  template <typename... Args>
+  pointer reallocInsert_(size_type index_pos, Args &&...args) {
+    if constexpr (kRealloc) {
+      value_type value(std::forward<Args>(args)...);
+      reallocate_(Ops::nextCapacity(*this));
+      pointer new_pos = data_ + index_pos;
+      std::memmove(static_cast<void *>(new_pos + 1), new_pos,
+                   (size_ - index_pos) * sizeof(value_type));
+      ::new (static_cast<void *>(new_pos)) value_type(value);
+      size_++;
+      return new_pos;
+    } else {
+      size_type new_capacity = Ops::nextCapacity(*this);
+      pointer tmp = allocate_(new_capacity);
+      pointer new_pos = tmp + index_pos;
+      try {
+        ::new (static_cast<void *>(new_pos))
+            value_type(std::forward<Args>(args)...);
+      } catch (...) {
+        deallocate_(tmp, new_capacity);
+        throw;
+      }
+      try {
+        vector_detail::relocate(data_, data_ + index_pos, tmp);
+        try {
+          vector_detail::relocate(data_ + index_pos, data_ + size_,
+                                  new_pos + 1);
+        } catch (...) {
+          std::destroy(tmp, new_pos);
+          throw;
+        }
+      } catch (...) {
+        std::destroy_at(new_pos);
+        deallocate_(tmp, new_capacity);
+        throw;
+      }
+      replaceBuffer_(tmp, new_capacity);
+      size_++;
+      return new_pos;
     }
+  }
+
+  // Takes the buffer of v, whose allocator can free it.
+  void stealFrom_(vector &v) noexcept {
+    data_ = v.data_;
+    size_ = v.size_;
+    capacity_ = v.capacity_;
+    v.data_ = nullptr;
+    v.size_ = 0;
+    v.capacity_ = 0;
+  }
+
+  void swapBuffers_(vector &other) noexcept {
+    std::swap(other.size_, size_);
+    std::swap(other.capacity_, capacity_);
+    std::swap(other.data_, data_);
+  }
+
+  void setZero_() noexcept {
+    std::destroy(data_, data_ + size_);
+    deallocate_(data_, capacity_);
+    data_ = nullptr;
     size_ = 0;
     capacity_ = 0;
   }
 };
+
+template <typename T, typename Allocator>
+bool operator==(const vector<T, Allocator> &a, const vector<T, Allocator> &b) {
+  return a.size() == b.size() && simd::equal(a.data(), b.data(), a.size());
+}
+
+template <typename T, typename Allocator>
+bool operator!=(const vector<T, Allocator> &a, const vector<T, Allocator> &b) {
+  return !(a == b);
+}
+
+#ifdef S21_CONTAINERS_DEBUG
+// Debug-build iterator: arithmetic that leaves [begin(), end()] and
+// dereferencing outside [begin(), end()) fail a check. Bounds are read from
+// the vector at the time of the operation.
+template <typename T, typename Allocator>
+template <bool Const>
+class vector<T, Allocator>::checkedIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = std::conditional_t<Const, const T *, T *>;
+  using reference = std::conditional_t<Const, const T &, T &>;
+
+  checkedIterator() = default;
+
+  template <bool C = Const, typename = std::enable_if_t<C>>
+  checkedIterator(const checkedIterator<false> &other) noexcept
+      : owner_(other.owner_), ptr_(other.ptr_) {}
+
+  reference operator*() const {
+    S21_CONTAINERS_ASSERT(owner_ != nullptr && ptr_ >= owner_->data_ &&
+                              ptr_ < owner_->data_ + owner_->size_,
+                          "dereferencing a vector iterator out of range");
+    return *ptr_;
+  }
+
+  pointer operator->() const { return &**this; }
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  checkedIterator &operator+=(difference_type n) {
+    S21_CONTAINERS_ASSERT(
+        owner_ != nullptr && ptr_ - owner_->data_ + n >= 0 &&
+            ptr_ - owner_->data_ + n <=
+                static_cast<difference_type>(owner_->size_),
+        "vector iterator moved out of range");
+    ptr_ += n;
+    return *this;
+  }
+
+  checkedIterator &operator-=(difference_type n) { return *this += -n; }
+  checkedIterator &operator++() { return *this += 1; }
+  checkedIterator &operator--() { return *this -= 1; }
+
+  checkedIterator operator++(int) {
+    checkedIterator old = *this;
+    *this += 1;
+    return old;
+  }
+
+  checkedIterator operator--(int) {
+    checkedIterator old = *this;
+    *this -= 1;
+    return old;
+  }
+
+  friend checkedIterator operator+(checkedIterator it, difference_type n) {
+    return it += n;
+  }
+
+  friend checkedIterator operator+(difference_type n, checkedIterator it) {
+    return it += n;
+  }
+
+  friend checkedIterator operator-(checkedIterator it, difference_type n) {
+    return it -= n;
+  }
+
+  friend difference_type operator-(const checkedIterator &a,
+                                   const checkedIterator &b) {
+    S21_CONTAINERS_ASSERT(a.owner_ == b.owner_,
+                          "subtracting iterators of different vectors");
+    return a.ptr_ - b.ptr_;
+  }
+
+  friend bool operator==(const checkedIterator &a, const checkedIterator &b) {
+    return a.ptr_ == b.ptr_;
+  }
+  friend bool operator!=(const checkedIterator &a, const checkedIterator &b) {
+    return a.ptr_ != b.ptr_;
+  }
+  friend bool operator<(const checkedIterator &a, const checkedIterator &b) {
+    return a.ptr_ < b.ptr_;
+  }
+  friend bool operator>(const checkedIterator &a, const checkedIterator &b) {
+    return a.ptr_ > b.ptr_;
+  }
+  friend bool operator<=(const checkedIterator &a, const checkedIterator &b) {
+    return a.ptr_ <= b.ptr_;
+  }
+  friend bool operator>=(const checkedIterator &a, const checkedIterator &b) {
+    return a.ptr_ >= b.ptr_;
+  }
+
+ private:
+  friend class vector;
+  friend class checkedIterator<!Const>;
+
+  checkedIterator(const vector *owner, T *ptr) noexcept
+      : owner_(owner), ptr_(ptr) {}
+
+  const vector *owner_ = nullptr;
+  T *ptr_ = nullptr;
+};
+#endif
+
+namespace pmr {
+// Vector that draws its storage from a std::pmr::memory_resource, such as
+// the arenas of s21_memory_resource.h.
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
 }  // namespace s21
 
 #endif  // SRC_S21_VECTOR_H_
@@ -0,0 +1,207 @@
+#ifndef SRC_S21_VECTOR_DETAIL_H_
+#define SRC_S21_VECTOR_DETAIL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+template <typename T>
+struct vector_growth;
+
+namespace vector_detail {
+// Trivially copyable elements of a vector using the default allocator live
+// in blocks of the C allocator, so that growth can use realloc, which
+// extends the block in place when the memory after it is free and copies
+// raw bytes otherwise.
+template <typename T, typename Allocator>
+inline constexpr bool kUseRealloc =
+    std::is_same<Allocator, std::allocator<T>>::value &&
+    std::is_trivially_copyable<T>::value &&
+    alignof(T) <= alignof(std::max_align_t);
+
+// Move-constructs [first, last) into raw storage at dest, copying instead
+// when the move constructor of T may throw and T is copyable. Nothing is
+// left constructed at dest if an exception escapes.
+template <typename T>
+T *relocate(T *first, T *last, T *dest) {
+  T *current = dest;
+  try {
+    for (; first != last; ++first, ++current) {
+      ::new (static_cast<void *>(current)) T(std::move_if_noexcept(*first));
+    }
+  } catch (...) {
+    std::destroy(dest, current);
+    throw;
+  }
+  return current;
+}
+
+// Relocates the live range [first, last) to dest inside one buffer; the
+// ranges may overlap and the vacated slots hold no objects afterwards.
+template <typename T>
+void shiftRange(T *first, T *last, T *dest) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memmove(static_cast<void *>(dest), first, (last - first) * sizeof(T));
+  } else if (dest > first) {
+    for (T *out = dest + (last - first); last != first;) {
+      ::new (static_cast<void *>(--out)) T(std::move(*--last));
+      std::destroy_at(last);
+    }
+  } else {
+    for (; first != last; ++first, ++dest) {
+      ::new (static_cast<void *>(dest)) T(std::move(*first));
+      std::destroy_at(first);
+    }
+  }
+}
+
+// Growth and insertion algorithms shared by s21::vector and
+// s21::small_vector. Both befriend Ops, which works on their data_, size_
+// and capacity_ and leaves buffer handling to their allocate_(),
+// deallocate_(), reallocate_() and replaceBuffer_().
+struct Ops {
+  // Capacity after the next growth step, as set by vector_growth<T>.
+  template <typename Vec>
+  static std::size_t nextCapacity(const Vec &v) {
+    using growth = vector_growth<typename Vec::value_type>;
+    if (v.capacity_ >= v.max_size() / growth::kNumerator) {
+      throw std::length_error("Vector capacity exceeds max_size");
+    }
+    if (v.capacity_ == 0) {
+      return std::max<std::size_t>(growth::kMinCapacity, 1);
+    }
+    std::size_t grown = v.capacity_ * growth::kNumerator / growth::kDenominator;
+    return std::max(grown, v.capacity_ + 1);
+  }
+
+  // Opens room for count elements at index_pos, shifting the tail once or
+  // relocating everything once into a bigger buffer, lets construct fill
+  // the raw gap and closes it again if construct throws.
+  template <typename Vec, typename Construct>
+  static void fillGap(Vec &v, std::size_t index_pos, std::size_t count,
+                      Construct &&construct) {
+    using T = typename Vec::value_type;
+    if (count == 0) return;
+    if (count > v.max_size() - v.size_) {
+      throw std::length_error("Vector size exceeds max_size");
+    }
+    if (v.size_ + count > v.capacity_) {
+      std::size_t new_capacity = std::max(v.size_ + count, nextCapacity(v));
+      if constexpr (Vec::kRealloc) {
+        v.reallocate_(new_capacity);
+      } else {
+        T *tmp = v.allocate_(new_capacity);
+        try {
+          relocate(v.data_, v.data_ + index_pos, tmp);
+          try {
+            relocate(v.data_ + index_pos, v.data_ + v.size_,
+                     tmp + index_pos + count);
+          } catch (...) {
+            std::destroy(tmp, tmp + index_pos);
+            throw;
+          }
+        } catch (...) {
+          v.deallocate_(tmp, new_capacity);
+          throw;
+        }
+        v.replaceBuffer_(tmp, new_capacity);
+        fillOrClose(v, index_pos, count, construct);
+        return;
+      }
+    }
+    shiftRange(v.data_ + index_pos, v.data_ + v.size_,
+               v.data_ + index_pos + count);
+    fillOrClose(v, index_pos, count, construct);
+  }
+
+  // Shrinks by destroying the tail or grows by letting construct fill the
+  // new slots, growing like push_back, or straight to count when that is
+  // not enough.
+  template <typename Vec, typename Construct>
+  static void resizeWith(Vec &v, std::size_t count, Construct &&construct) {
+    if (count <= v.size_) {
+      std::destroy(v.data_ + count, v.data_ + v.size_);
+    } else {
+      if (count > v.capacity_) {
+        v.reallocate_(std::max(count, nextCapacity(v)));
+      }
+      construct(v.data_ + v.size_, count - v.size_);
+    }
+    v.size_ = count;
+  }
+
+  // Inserts [first, last) at index_pos. Forward ranges shift the tail once;
+  // single-pass input is appended and rotated into place.
+  template <typename Vec, typename InputIt>
+  static void insertRange(Vec &v, std::size_t index_pos, InputIt first,
+                          InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of<std::forward_iterator_tag, category>::value) {
+      std::size_t count = std::distance(first, last);
+      fillGap(v, index_pos, count,
+              [&first, &last](typename Vec::pointer gap, std::size_t) {
+                std::uninitialized_copy(first, last, gap);
+              });
+    } else {
+      std::size_t old_size = v.size_;
+      for (; first != last; ++first) v.emplace_back(*first);
+      std::rotate(v.data_ + index_pos, v.data_ + old_size,
+                  v.data_ + v.size_);
+    }
+  }
+
+  // Builds the elements first, so args may refer to elements of v, then
+  // moves them in with a single shift of the tail. Returns the index of
+  // the last inserted element, or index_pos when args is empty.
+  template <typename Vec, typename... Args>
+  static std::size_t insertMany(Vec &v, std::size_t index_pos,
+                                Args &&...args) {
+    if constexpr (sizeof...(Args) == 0) {
+      return index_pos;
+    } else {
+      using T = typename Vec::value_type;
+      // Direct-initialised in raw storage: a functional cast T(arg) would
+      // accept any conversion a C-style cast allows.
+      alignas(T) unsigned char raw[sizeof(T) * sizeof...(Args)];
+      T *items = reinterpret_cast<T *>(raw);
+      T *built = items;
+      try {
+        ((::new (static_cast<void *>(built)) T(std::forward<Args>(args)),
+          ++built),
+         ...);
+        insertRange(v, index_pos, std::make_move_iterator(items),
+                    std::make_move_iterator(built));
+      } catch (...) {
+        std::destroy(items, built);
+        throw;
+      }
+      std::destroy(items, built);
+      return index_pos + sizeof...(Args) - 1;
+    }
+  }
+
+ private:
+  template <typename Vec, typename Construct>
+  static void fillOrClose(Vec &v, std::size_t index_pos, std::size_t count,
+                          Construct &construct) {
+    typename Vec::pointer gap = v.data_ + index_pos;
+    try {
+      construct(gap, count);
+    } catch (...) {
+      shiftRange(gap + count, v.data_ + v.size_ + count, gap);
+      throw;
+    }
+    v.size_ += count;
+  }
+};
+}  // namespace vector_detail
+}  // namespace s21
+
+#endif  // SRC_S21_VECTOR_DETAIL_H_
@@ -0,0 +1,29 @@
+// Built with S21_CONTAINERS_DEBUG: linking an object twice through one hook
+// and destroying a linked object must stop.
+#include <gtest/gtest.h>
+
+#include "../../s21_intrusive_list.h"
+
+namespace {
+struct Item {
+  s21::intrusive_list_hook hook;
+};
+
+using ItemList = s21::intrusive_list<Item, &Item::hook>;
+}  // namespace
+
+TEST(TestIntrusiveListDebug, Link_1) {
+  Item item;
+  ItemList list;
+  list.push_back(item);
+  EXPECT_DEATH(list.push_back(item), "already linked");
+  EXPECT_DEATH(
+      {
+        ItemList other;
+        Item doomed;
+        other.push_back(doomed);
+      },
+      "destroying a linked object");
+  list.erase(item);
+  EXPECT_DEATH(list.erase(item), "unlinked object");
+}
@@ -0,0 +1,16 @@
+// Built with S21_CONTAINERS_DEBUG: span accesses and slices outside the
+// viewed range must stop.
+#include <gtest/gtest.h>
+
+#include "../../s21_span.h"
+
+TEST(TestSpanDebug, Index_1) {
+  int items[] = {1, 2, 3};
+  s21::span<int> view(items);
+  EXPECT_EQ(view[2], 3);
+  EXPECT_DEATH(view[3], "span index out of range");
+  EXPECT_DEATH(view.first(4), "beyond the size");
+  EXPECT_DEATH(view.subspan(2, 2), "beyond the size");
+  EXPECT_DEATH(view.subspan<4>(), "beyond the size");
+  EXPECT_DEATH(s21::span<int>().front(), "empty span");
+}
@@ -0,0 +1,38 @@
+// Built with S21_CONTAINERS_DEBUG: unchecked vector operations must stop on
+// broken preconditions.
+#include <gtest/gtest.h>
+
+#include "../../s21_vector.h"
+
+TEST(TestVectorDebug, Index_1) {
+  s21::vector<int> vector1{1, 2, 3};
+  EXPECT_EQ(vector1[2], 3);
+  EXPECT_DEATH(vector1[3], "index out of range");
+  const s21::vector<int> vector2;
+  EXPECT_DEATH(vector2[0], "index out of range");
+}
+
+TEST(TestVectorDebug, Front_1) {
+  s21::vector<int> vector1;
+  EXPECT_DEATH(vector1.front(), "empty vector");
+  EXPECT_DEATH(vector1.back(), "empty vector");
+}
+
+TEST(TestVectorDebug, Iterator_1) {
+  s21::vector<int> vector1{1, 2, 3};
+  auto it = vector1.begin();
+  it += 3;
+  EXPECT_EQ(it == vector1.end(), true);
+  EXPECT_DEATH(*it, "out of range");
+  EXPECT_DEATH(++it, "out of range");
+  EXPECT_DEATH(vector1.begin() - 1, "out of range");
+  int sum = 0;
+  for (auto i = vector1.begin(); i != vector1.end(); ++i) sum += *i;
+  EXPECT_EQ(sum, 6);
+  s21::vector<int>::const_iterator first = vector1.begin();
+  EXPECT_EQ(vector1.end() - first, 3);
+  vector1.insert(vector1.begin() + 1, 5);
+  vector1.insert_many(vector1.end(), 7, 8);
+  EXPECT_EQ(vector1[1], 5);
+  EXPECT_EQ(vector1.back(), 8);
+}
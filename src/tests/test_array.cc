@@ -229,3 +229,22 @@ TEST(TestArray, Swap) {
   ASSERT_EQ(arr_instance_s21_2[1], 'v');
   ASSERT_EQ(arr_instance_s21_2[2], '\0');
 }
+
+TEST(TestArray, Search) {
+  s21::array<int, 21> arr_instance_s21;
+  for (int i = 0; i < 21; i++) arr_instance_s21[i] = (i * 8) % 21 - 10;
+  ASSERT_EQ(arr_instance_s21.find(4) - arr_instance_s21.begin(), 7);
+  ASSERT_EQ(arr_instance_s21.find(42), arr_instance_s21.end());
+  ASSERT_TRUE(arr_instance_s21.contains(-10));
+  ASSERT_EQ(arr_instance_s21.min(), -10);
+  ASSERT_EQ(arr_instance_s21.max(), 10);
+  ASSERT_EQ(arr_instance_s21.sum(), 0);
+
+  s21::array<int, 21> arr_instance_s21_2(arr_instance_s21);
+  ASSERT_TRUE(arr_instance_s21 == arr_instance_s21_2);
+  arr_instance_s21_2[20] = 100;
+  ASSERT_TRUE(arr_instance_s21 != arr_instance_s21_2);
+
+  s21::array<float, 0> arr_instance_s21_3;
+  ASSERT_THROW(arr_instance_s21_3.min(), std::out_of_range);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+TEST(btree_map_element, at_00) {
+  s21::btree_map<int, std::string> m1{{2, "b"}, {1, "a"}, {3, "c"}};
+  ASSERT_EQ(m1.at(1), "a");
+  ASSERT_EQ(m1.at(3), "c");
+  ASSERT_THROW(m1.at(4), std::out_of_range);
+  m1[4] = "d";
+  m1[1] += "a";
+  ASSERT_EQ(m1.at(4), "d");
+  ASSERT_EQ(m1.at(1), "aa");
+  ASSERT_EQ(m1.size(), 4U);
+}
+
+TEST(btree_map_mod, insert_00) {
+  std::mt19937 gen(3);
+  s21::btree_map<int, int> m1;
+  std::map<int, int> m2;
+  for (int i = 0; i < 30000; ++i) {
+    int key = static_cast<int>(gen() % 10000);
+    ASSERT_EQ(m1.insert(key, i).second, m2.insert({key, i}).second);
+    if (i % 4 == 0) {
+      int gone = static_cast<int>(gen() % 10000);
+      ASSERT_EQ(m1.erase(gone), m2.erase(gone));
+    }
+  }
+  ASSERT_EQ(m1.size(), m2.size());
+  auto it = m1.begin();
+  for (const auto &item : m2) {
+    ASSERT_EQ(it->first, item.first);
+    ASSERT_EQ(it->second, item.second);
+    ++it;
+  }
+  ASSERT_EQ(it == m1.end(), true);
+  auto result = m1.insert_or_assign(m2.begin()->first, -1);
+  ASSERT_EQ(result.second, false);
+  ASSERT_EQ(m1.begin()->second, -1);
+}
+
+TEST(btree_map_lookup, transparent_00) {
+  s21::btree_map<std::string, int, std::less<>> m1{{"one", 1}, {"two", 2}};
+  ASSERT_EQ(m1.contains("one"), true);
+  ASSERT_EQ(m1.find("two")->second, 2);
+  ASSERT_EQ(m1.lower_bound("p")->first, "two");
+  ASSERT_EQ(m1.upper_bound("two") == m1.end(), true);
+}
+
+TEST(btree_map_lookup, compare_00) {
+  s21::btree_map<int, int, std::greater<int>> m1{{1, 10}, {3, 30}};
+  ASSERT_EQ(m1.begin()->first, 3);
+  ASSERT_EQ(m1.key_comp()(3, 1), true);
+  ASSERT_EQ(m1.value_comp()({3, 0}, {1, 0}), true);
+  ASSERT_EQ(m1.value_comp()({1, 0}, {3, 0}), false);
+}
+
+TEST(btree_map_capacity, memory_00) {
+  std::vector<std::pair<int, int>> items;
+  for (int i = 0; i < 100000; ++i) items.push_back({i, i});
+  s21::btree_map<int, int> m1(items.begin(), items.end());
+  ASSERT_EQ(m1.size(), items.size());
+  // The tree map spends a node with three pointers on every pair.
+  double perKey = static_cast<double>(m1.memory_usage()) / m1.size();
+  ASSERT_LT(perKey, 2.0 * sizeof(std::pair<int, int>));
+  ASSERT_LT(perKey, sizeof(s21::map<int, int>::Node));
+  int expected = 0;
+  for (auto it = m1.begin(); it != m1.end(); ++it) {
+    ASSERT_EQ(it->first, expected++);
+  }
+}
+
+TEST(btree_map_mod, merge_00) {
+  s21::btree_map<int, int> m1{{1, 1}, {3, 3}};
+  s21::btree_map<int, int> m2{{2, 2}, {3, 30}};
+  m1.merge(m2);
+  ASSERT_EQ(m1.size(), 3U);
+  ASSERT_EQ(m1.at(3), 3);
+  ASSERT_EQ(m2.empty(), true);
+  m1.swap(m2);
+  ASSERT_EQ(m1.empty(), true);
+  ASSERT_EQ(m2.size(), 3U);
+  auto result = m2.insert_many(std::pair<int, int>{7, 7},
+                               std::pair<int, int>{1, 0});
+  ASSERT_EQ(result.size(), 2U);
+  ASSERT_EQ(result[1].second, false);
+  ASSERT_EQ(m2.size(), 4U);
+}
+
+TEST(btree_map_mod, insert_many_00) {
+  s21::btree_map<int, int> m1;
+  auto result = m1.insert_many(std::pair<int, int>{3, 30},
+                               std::pair<int, int>{1, 10},
+                               std::pair<int, int>{2, 20},
+                               std::pair<int, int>{1, -1});
+  ASSERT_EQ(result.size(), 4U);
+  ASSERT_EQ(result[0].first->second, 30);
+  ASSERT_EQ(result[1].first->second, 10);
+  ASSERT_EQ(result[2].first->second, 20);
+  ASSERT_EQ(result[3].first->second, 10);
+  ASSERT_EQ(result[2].second, true);
+  ASSERT_EQ(result[3].second, false);
+}
+
+TEST(btree_map_alloc, pmr_00) {
+  using alloc = std::pmr::polymorphic_allocator<std::pair<int, std::string>>;
+  using pmr_map = s21::btree_map<int, std::string, std::less<int>, alloc>;
+  std::pmr::unsynchronized_pool_resource first;
+  std::pmr::unsynchronized_pool_resource second;
+  pmr_map m1{alloc(&first)};
+  pmr_map m2{alloc(&second)};
+  for (int i = 0; i < 1000; ++i) m1.insert(i, std::to_string(i));
+  m2 = std::move(m1);
+  ASSERT_EQ(m2.get_allocator().resource(), &second);
+  ASSERT_EQ(m2.size(), 1000U);
+  ASSERT_EQ(m2.at(512), "512");
+  ASSERT_TRUE(m1.empty());
+  for (int i = 1000; i < 1100; ++i) m2.insert(i, std::to_string(i));
+  m2.erase(0);
+  m1 = m2;
+  ASSERT_EQ(m1.get_allocator().resource(), &first);
+  ASSERT_EQ(m1.size(), 1099U);
+  pmr_map m3(m1);
+  ASSERT_EQ(m3.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  ASSERT_EQ(m3.at(1099), "1099");
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+template <typename S, typename R>
+void expectSame(const S &s, const R &ref) {
+  ASSERT_EQ(s.size(), ref.size());
+  auto it = s.begin();
+  for (const auto &key : ref) {
+    ASSERT_EQ(*it, key);
+    ++it;
+  }
+  ASSERT_EQ(it == s.end(), true);
+  for (auto rit = ref.rbegin(); rit != ref.rend(); ++rit) {
+    --it;
+    ASSERT_EQ(*it, *rit);
+  }
+  ASSERT_EQ(it == s.begin(), true);
+}
+}  // namespace
+
+TEST(btree_set_capacity, empty_00) {
+  s21::btree_set<int> s1;
+  ASSERT_EQ(s1.empty(), true);
+  ASSERT_EQ(s1.size(), 0U);
+  ASSERT_EQ(s1.begin() == s1.end(), true);
+  ASSERT_EQ(s1.contains(1), false);
+  ASSERT_EQ(s1.memory_usage(), 0U);
+}
+
+TEST(btree_set_mod, insert_00) {
+  s21::btree_set<int> s1{5, 1, 5, 3};
+  ASSERT_EQ(s1.size(), 3U);
+  auto result = s1.insert(3);
+  ASSERT_EQ(result.second, false);
+  ASSERT_EQ(*result.first, 3);
+  result = s1.insert(4);
+  ASSERT_EQ(result.second, true);
+  ASSERT_EQ(*result.first, 4);
+  expectSame(s1, std::set<int>{1, 3, 4, 5});
+}
+
+TEST(btree_set_mod, erase_00) {
+  std::mt19937 gen(7);
+  s21::btree_set<int> s1;
+  std::set<int> s2;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 5000);
+    if (gen() % 3 == 0) {
+      ASSERT_EQ(s1.erase(key), s2.erase(key));
+    } else {
+      ASSERT_EQ(s1.insert(key).second, s2.insert(key).second);
+    }
+  }
+  expectSame(s1, s2);
+  for (auto it = s2.begin(); it != s2.end(); it = s2.erase(it)) {
+    s1.erase(s1.find(*it));
+  }
+  ASSERT_EQ(s1.empty(), true);
+  ASSERT_EQ(s1.memory_usage(), 0U);
+}
+
+TEST(btree_set_mod, assign_sorted_00) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 3000; ++i) keys.push_back(std::to_string(100000 + i));
+  s21::btree_set<std::string> sorted(keys.begin(), keys.end());
+  s21::btree_set<std::string> inserted;
+  for (const auto &key : keys) inserted.insert(key);
+  expectSame(sorted, std::set<std::string>(keys.begin(), keys.end()));
+  ASSERT_LT(sorted.memory_usage(), inserted.memory_usage());
+
+  std::vector<int> mixed{1, 2, 3, 9, 4, 4, 10, 5};
+  s21::btree_set<int> s1;
+  s1.assign_sorted(mixed.begin(), mixed.end());
+  expectSame(s1, std::set<int>(mixed.begin(), mixed.end()));
+  for (int key : mixed) s1.erase(key);
+  ASSERT_EQ(s1.empty(), true);
+}
+
+TEST(btree_set_lookup, bounds_00) {
+  std::vector<int> keys;
+  for (int i = 0; i < 10000; i += 2) keys.push_back(i);
+  s21::btree_set<int> s1(keys.begin(), keys.end());
+  std::set<int> s2(keys.begin(), keys.end());
+  for (int key = -1; key < 10001; ++key) {
+    auto lower = s1.lower_bound(key);
+    auto upper = s1.upper_bound(key);
+    if (s2.lower_bound(key) == s2.end()) {
+      ASSERT_EQ(lower == s1.end(), true);
+    } else {
+      ASSERT_EQ(*lower, *s2.lower_bound(key));
+    }
+    if (s2.upper_bound(key) == s2.end()) {
+      ASSERT_EQ(upper == s1.end(), true);
+    } else {
+      ASSERT_EQ(*upper, *s2.upper_bound(key));
+    }
+  }
+  s21::btree_set<int> copy(s1);
+  s21::btree_set<int> moved(std::move(s1));
+  expectSame(copy, s2);
+  expectSame(moved, s2);
+}
+
+TEST(btree_set_mod, insert_many_00) {
+  s21::btree_set<int> s1;
+  auto result = s1.insert_many(3, 1, 2, 1);
+  ASSERT_EQ(result.size(), 4U);
+  ASSERT_EQ(*result[0].first, 3);
+  ASSERT_EQ(*result[1].first, 1);
+  ASSERT_EQ(*result[2].first, 2);
+  ASSERT_EQ(*result[3].first, 1);
+  ASSERT_EQ(result[0].second, true);
+  ASSERT_EQ(result[3].second, false);
+  ASSERT_EQ(s1.size(), 3U);
+}
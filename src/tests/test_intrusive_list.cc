@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+struct Connection {
+  explicit Connection(int i) : id(i) {}
+
+  int id;
+  s21::intrusive_list_hook byAge;
+  s21::intrusive_list_hook byState;
+};
+
+using AgeList = s21::intrusive_list<Connection, &Connection::byAge>;
+using StateList = s21::intrusive_list<Connection, &Connection::byState>;
+
+std::vector<int> ids(const AgeList &list) {
+  std::vector<int> result;
+  for (const Connection &c : list) result.push_back(c.id);
+  return result;
+}
+}  // namespace
+
+TEST(IntrusiveList, Link_1) {
+  Connection c1(1), c2(2), c3(3), c4(4);
+  AgeList list;
+  EXPECT_TRUE(list.empty());
+  list.push_back(c2);
+  list.push_back(c4);
+  list.push_front(c1);
+  auto it = list.insert(list.iterator_to(c4), c3);
+  EXPECT_EQ(3, it->id);
+  EXPECT_EQ(4U, list.size());
+  EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), ids(list));
+  EXPECT_EQ(&c1, &list.front());
+  EXPECT_EQ(&c4, &list.back());
+  EXPECT_EQ(4, (*--list.end()).id);
+
+  list.erase(c2);
+  EXPECT_FALSE(c2.byAge.is_linked());
+  EXPECT_EQ(3, list.erase(list.begin())->id);
+  EXPECT_EQ(std::vector<int>({3, 4}), ids(list));
+  EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+  list.pop_back();
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+  EXPECT_THROW(list.pop_front(), std::out_of_range);
+  EXPECT_THROW(list.front(), std::out_of_range);
+}
+
+TEST(IntrusiveList, Hooks_1) {
+  std::vector<Connection> pool;
+  for (int i = 0; i < 6; ++i) pool.emplace_back(i);
+  AgeList age;
+  StateList idle;
+  for (Connection &c : pool) {
+    age.push_back(c);
+    if (c.id % 2 == 0) idle.push_front(c);
+  }
+  EXPECT_EQ(6U, age.size());
+  EXPECT_EQ(3U, idle.size());
+  EXPECT_EQ(4, idle.front().id);
+
+  idle.erase(pool[2]);
+  EXPECT_TRUE(pool[2].byAge.is_linked());
+  age.erase(pool[4]);
+  EXPECT_EQ(4, idle.front().id);
+  EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 5}), ids(age));
+
+  Connection copy(pool[0]);
+  EXPECT_FALSE(copy.byAge.is_linked());
+  pool[1] = copy;
+  EXPECT_TRUE(pool[1].byAge.is_linked());
+  idle.clear();
+  EXPECT_FALSE(pool[0].byState.is_linked());
+  age.clear();
+}
+
+TEST(IntrusiveList, Move_1) {
+  Connection c1(1), c2(2), c3(3);
+  AgeList a;
+  a.push_back(c1);
+  a.push_back(c2);
+  AgeList b(std::move(a));
+  EXPECT_TRUE(a.empty());
+  EXPECT_TRUE(a.begin() == a.end());
+  EXPECT_EQ(std::vector<int>({1, 2}), ids(b));
+  a.push_back(c3);
+  a.swap(b);
+  EXPECT_EQ(std::vector<int>({3}), ids(b));
+  EXPECT_EQ(std::vector<int>({1, 2}), ids(a));
+  a.splice(a.begin(), b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(std::vector<int>({3, 1, 2}), ids(a));
+  EXPECT_EQ(3U, a.size());
+  b = std::move(a);
+  EXPECT_EQ(std::vector<int>({3, 1, 2}), ids(b));
+  EXPECT_EQ(2, (--b.end())->id);
+}
+
+namespace {
+struct Resource {
+  virtual ~Resource() = default;
+  int handle = -1;
+};
+
+// Not standard layout: virtual functions, data in both the base and the
+// derived class, and private state next to the public hooks.
+class PooledConnection : public Resource {
+ public:
+  explicit PooledConnection(int id) : id_(id) {}
+  int id() const { return id_; }
+
+  s21::intrusive_list_hook idle;
+
+ private:
+  int id_;
+  double lastUsed_ = 0;
+};
+
+using IdleList = s21::intrusive_list<PooledConnection, &PooledConnection::idle>;
+}  // namespace
+
+TEST(IntrusiveList, NonStandardLayout_1) {
+  static_assert(!std::is_standard_layout<PooledConnection>::value);
+  std::vector<PooledConnection> pool;
+  for (int i = 0; i < 4; ++i) pool.emplace_back(i);
+  IdleList idle;
+  for (PooledConnection &c : pool) idle.push_back(c);
+  idle.erase(pool[2]);
+  std::vector<int> ids;
+  for (const PooledConnection &c : idle) ids.push_back(c.id());
+  EXPECT_EQ(std::vector<int>({0, 1, 3}), ids);
+  EXPECT_EQ(&pool[0], &idle.front());
+  EXPECT_EQ(&pool[3], &idle.back());
+  EXPECT_EQ(&pool[1], &*idle.iterator_to(pool[1]));
+  idle.clear();
+}
@@ -1,8 +1,39 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <list>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 #include "../s21_containers.h"
+#include "../s21_memory_resource.h"
+#include "test_utils.h"
+
+namespace {
+using s21_test::CountingResource;
+
+// Counts how it was constructed.
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  Tracked(int a, int b) : value(a + b) {}
+  explicit Tracked(int v) : value(v) {}
+  Tracked(const Tracked& other) : value(other.value) { ++copies; }
+  Tracked(Tracked&& other) noexcept : value(other.value) { ++moves; }
+  Tracked& operator=(const Tracked&) = default;
+
+  int value;
+};
+
+struct NoDefault {
+  explicit NoDefault(int v) : value(v) {}
+  int value;
+};
+}  // namespace
 
 TEST(DoublyLinkedList, DefaultConstructor) {
   s21::list<char> test_custom;
@@ -186,6 +217,60 @@ TEST(DoublyLinkedList, Splice) {
   }
 }
 
+TEST(DoublyLinkedList, Splice_2) {
+  s21::list<int> list1 = {1, 2, 3};
+  s21::list<int> list2 = {10, 20, 30, 40};
+  std::list<int> list1_original = {1, 2, 3};
+  std::list<int> list2_original = {10, 20, 30, 40};
+
+  auto moved = ++list2.begin();
+  list1.splice(list1.end(), list2, moved);
+  list1_original.splice(list1_original.end(), list2_original,
+                        ++list2_original.begin());
+  EXPECT_EQ(20, *moved);
+  EXPECT_TRUE(++moved == list1.end());
+
+  auto first = list2.begin();
+  auto last = --list2.end();
+  list1.splice(++list1.begin(), list2, first, last);
+  list1_original.splice(++list1_original.begin(), list2_original,
+                        list2_original.begin(), --list2_original.end());
+
+  list1.splice(list1.begin(), list1, --list1.end());
+  list1_original.splice(list1_original.begin(), list1_original,
+                        --list1_original.end());
+  list1.splice(list1.end(), list1, list1.begin(), ++(++list1.begin()));
+  list1_original.splice(list1_original.end(), list1_original,
+                        list1_original.begin(),
+                        ++(++list1_original.begin()));
+
+  EXPECT_EQ(list1_original.size(), list1.size());
+  EXPECT_EQ(list2_original.size(), list2.size());
+  auto it_custom = list1.begin();
+  for (int v : list1_original) EXPECT_EQ(v, *it_custom++);
+  it_custom = --list1.end();
+  for (auto it = list1_original.rbegin(); it != list1_original.rend(); ++it) {
+    EXPECT_EQ(*it, *it_custom--);
+  }
+  EXPECT_EQ(40, list2.front());
+  EXPECT_EQ(40, list2.back());
+}
+
+TEST(DoublyLinkedList, Splice_3) {
+  s21::list<int> list1 = {1, 2};
+  s21::list<int> list2;
+  list1.splice(list1.begin(), list2);
+  list1.splice(list1.begin(), list1);
+  list1.splice(list1.begin(), list1, list1.begin());
+  list1.splice(list1.end(), list2, list2.begin(), list2.end());
+  EXPECT_EQ(2, list1.size());
+  EXPECT_EQ(1, list1.front());
+  list2.splice(list2.end(), list1);
+  EXPECT_TRUE(list1.empty());
+  EXPECT_TRUE(list1.begin() == list1.end());
+  EXPECT_EQ(2, list2.back());
+}
+
 TEST(DoublyLinkedList, Sort_1) {
   s21::list<int> list1 = {-1, -2, 2, 3, 4, 4, 5, 10, 15};
   std::list<int> list1_original = {-1, -2, 2, 3, 4, 4, 5, 10, 15};
@@ -231,6 +316,49 @@ TEST(DoublyLinkedList, Sort_3) {
   EXPECT_EQ(list1_original.size(), list1.size());
 }
 
+TEST(DoublyLinkedList, Sort_4) {
+  std::mt19937 gen(7);
+  s21::list<std::pair<int, int>> list1;
+  std::list<std::pair<int, int>> list1_original;
+  for (int i = 0; i < 5000; ++i) {
+    std::pair<int, int> item(static_cast<int>(gen() % 50), i);
+    list1.push_back(item);
+    list1_original.push_back(item);
+  }
+  auto by_key = [](const auto& a, const auto& b) { return a.first > b.first; };
+  list1.sort(by_key);
+  list1_original.sort(by_key);
+
+  EXPECT_EQ(list1_original.size(), list1.size());
+  auto it_custom = list1.begin();
+  for (auto const& item : list1_original) EXPECT_EQ(item, *it_custom++);
+  EXPECT_TRUE(it_custom == list1.end());
+  auto it_back = --list1.end();
+  for (auto it = list1_original.rbegin(); it != list1_original.rend(); ++it) {
+    EXPECT_EQ(*it, *it_back--);
+  }
+}
+
+TEST(DoublyLinkedList, Sort_5) {
+  s21::list<int> list1 = {5, 3, 9, 1, 7, 2, 8};
+  int calls = 0;
+  auto failing = [&calls](int a, int b) {
+    if (++calls == 6) throw std::runtime_error("comparator");
+    return a < b;
+  };
+  EXPECT_THROW(list1.sort(failing), std::runtime_error);
+  EXPECT_EQ(7, list1.size());
+  int sum = 0;
+  for (int v : list1) sum += v;
+  EXPECT_EQ(35, sum);
+  list1.sort();
+  int previous = 0;
+  for (int v : list1) {
+    EXPECT_LE(previous, v);
+    previous = v;
+  }
+}
+
 TEST(DoublyLinkedList, Merge_1) {
   s21::list<int> list1 = {2, 6, 8, 3, -9, 0, 3, 3, 4, 7, 9, 100};
   s21::list<int> list2 = {-1, -2, 2, 3, 4, 4, 5, 10, 15};
@@ -355,3 +483,111 @@ TEST(DoublyLinkedList, InsertManyBack) {
   EXPECT_EQ(7, check);
   EXPECT_EQ(7, list1.size());
 }
+
+TEST(DoublyLinkedList, Merge_4) {
+  s21::list<std::pair<int, char>> list1 = {
+      {9, 'a'}, {5, 'a'}, {5, 'b'}, {1, 'a'}};
+  s21::list<std::pair<int, char>> list2 = {{7, 'c'}, {5, 'c'}, {0, 'c'}};
+  auto first = list1.begin();
+  list1.merge(list2, [](const auto& a, const auto& b) {
+    return a.first > b.first;
+  });
+  EXPECT_EQ(0, list2.size());
+  EXPECT_TRUE(list2.begin() == list2.end());
+  s21::list<std::pair<int, char>> expected = {{9, 'a'}, {7, 'c'}, {5, 'a'},
+                                              {5, 'b'}, {5, 'c'}, {1, 'a'},
+                                              {0, 'c'}};
+  EXPECT_EQ(expected.size(), list1.size());
+  EXPECT_TRUE(first == list1.begin());
+  auto it = list1.begin();
+  for (auto const& item : expected) EXPECT_EQ(item, *it++);
+}
+
+TEST(DoublyLinkedList, Layout_1) {
+  CountingResource counting;
+  s21::pmr::list<int> list1(&counting);
+  s21::pmr::list<int> list2(std::move(list1));
+  EXPECT_EQ(0U, counting.allocations);
+  EXPECT_TRUE(list2.begin() == list2.end());
+  EXPECT_TRUE(--list2.begin() == list2.end());
+
+  list2.push_back(1);
+  list2.push_back(2);
+  EXPECT_EQ(2U, counting.allocations);
+  auto first = list2.begin();
+  s21::pmr::list<int> list3(std::move(list2));
+  EXPECT_TRUE(list2.empty());
+  EXPECT_TRUE(list2.begin() == list2.end());
+  EXPECT_TRUE(first == list3.begin());
+  EXPECT_EQ(2, *--list3.end());
+  list2.swap(list3);
+  EXPECT_TRUE(list3.begin() == list3.end());
+  EXPECT_EQ(2U, list2.size());
+  EXPECT_EQ(1, *++list2.end());
+  EXPECT_EQ(2U, counting.allocations);
+
+  s21::list<NoDefault> list4;
+  list4.push_back(NoDefault(5));
+  list4.reverse();
+  EXPECT_EQ(5, list4.front().value);
+}
+
+TEST(DoublyLinkedList, Pool_1) {
+  CountingResource counting;
+  s21::pmr::pool_resource pool(&counting);
+  s21::pmr::list<int> queue1(&pool);
+  s21::pmr::list<int> queue2(&pool);
+  for (int i = 0; i < 16; ++i) queue1.push_back(i);
+  size_t warm = counting.allocations;
+  for (int i = 0; i < 10000; ++i) {
+    queue1.push_back(i);
+    queue1.pop_front();
+  }
+  EXPECT_EQ(warm, counting.allocations);
+  queue2.splice(queue2.end(), queue1, queue1.begin());
+  queue2.splice(queue2.end(), queue1);
+  queue1 = std::move(queue2);
+  EXPECT_EQ(16U, queue1.size());
+  EXPECT_EQ(9984, queue1.front());
+  s21::pmr::list<int> copy(queue1);
+  EXPECT_TRUE(copy.get_allocator().resource() !=
+              queue1.get_allocator().resource());
+  EXPECT_EQ(9999, copy.back());
+  EXPECT_EQ(warm, counting.allocations);
+}
+
+TEST(DoublyLinkedList, Emplace_1) {
+  Tracked::copies = 0;
+  Tracked::moves = 0;
+  s21::list<Tracked> list1;
+  EXPECT_EQ(3, list1.emplace_back(1, 2).value);
+  EXPECT_EQ(7, list1.emplace_front(7).value);
+  auto it = list1.emplace(--list1.end(), 2, 3);
+  EXPECT_EQ(5, (*it).value);
+  EXPECT_EQ(0, Tracked::copies);
+  EXPECT_EQ(0, Tracked::moves);
+
+  list1.push_back(Tracked(8));
+  list1.push_front(Tracked(6));
+  list1.insert(list1.begin(), Tracked(4));
+  EXPECT_EQ(0, Tracked::copies);
+  EXPECT_EQ(3, Tracked::moves);
+
+  Tracked lvalue(9);
+  list1.insert_many_back(Tracked(10), lvalue, 11);
+  list1.insert_many(list1.begin(), 1, Tracked(2));
+  EXPECT_EQ(1, Tracked::copies);
+  EXPECT_EQ(5, Tracked::moves);
+
+  int expected[] = {1, 2, 4, 6, 7, 5, 3, 8, 10, 9, 11};
+  EXPECT_EQ(11U, list1.size());
+  auto item = list1.begin();
+  for (int value : expected) EXPECT_EQ(value, (*item++).value);
+
+  s21::list<std::string> strings;
+  std::string text(100, 'x');
+  strings.push_back(std::move(text));
+  EXPECT_TRUE(text.empty());
+  strings.emplace_back(3, 'y');
+  EXPECT_EQ("yyy", strings.back());
+}
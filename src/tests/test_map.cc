@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <memory_resource>
 #include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 
 #include "../s21_containers.h"
 
@@ -109,3 +113,241 @@ TEST(map_mod, insert_02) {
   EXPECT_EQ(m1.contains(-1), true);
   EXPECT_EQ(m1.contains(4), true);
 }
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator(std::size_t* counter) : allocations(counter) {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>& other)
+      : allocations(other.allocations) {}
+
+  T* allocate(std::size_t n) {
+    ++*allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U>& other) const {
+    return allocations == other.allocations;
+  }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U>& other) const {
+    return allocations != other.allocations;
+  }
+
+  std::size_t* allocations;
+};
+
+TEST(map_alloc, pool_00) {
+  std::size_t allocations = 0;
+  using alloc = CountingAllocator<std::pair<int, int>>;
+  s21::map<int, int, std::less<int>, alloc> m1{alloc(&allocations)};
+  ASSERT_EQ(allocations, 0U);
+  for (int i = 0; i < 1000; ++i) m1.insert(i, i * i);
+  ASSERT_EQ(m1.size(), 1000U);
+  ASSERT_LE(allocations, 10U);
+  std::size_t before = allocations;
+  for (int i = 0; i < 500; ++i) m1.erase(m1.begin());
+  for (int i = 1000; i < 1500; ++i) m1.insert(i, i);
+  ASSERT_EQ(allocations, before);
+  ASSERT_EQ(m1.at(1499), 1499);
+  m1.clear();
+  ASSERT_EQ(m1.empty(), true);
+  m1.insert(7, 49);
+  ASSERT_EQ(m1.at(7), 49);
+}
+
+TEST(map_alloc, pool_01) {
+  s21::map<std::string, std::string> m1;
+  for (int i = 0; i < 100; ++i) {
+    m1.insert(std::to_string(i), std::string(40, 'x'));
+  }
+  s21::map<std::string, std::string> m2(m1);
+  m1.clear();
+  ASSERT_EQ(m2.size(), 100U);
+  ASSERT_EQ(m2.at("42"), std::string(40, 'x'));
+  m1 = m2;
+  ASSERT_EQ(m1.size(), 100U);
+  ASSERT_EQ(m1.contains("99"), true);
+}
+
+template <typename T>
+struct CopyPropagatingAllocator : CountingAllocator<T> {
+  using propagate_on_container_copy_assignment = std::true_type;
+  using CountingAllocator<T>::CountingAllocator;
+};
+
+// Throws from its copy constructor once copiesLeft runs out.
+struct ThrowingCopy {
+  static int copiesLeft;
+  explicit ThrowingCopy(int v) : text(std::to_string(v)) {}
+  ThrowingCopy(const ThrowingCopy& other) : text(other.text) {
+    if (copiesLeft-- == 0) throw std::runtime_error("copy");
+  }
+  std::string text;
+};
+
+int ThrowingCopy::copiesLeft = 0;
+
+TEST(map_alloc, copy_assign_00) {
+  std::size_t first = 0;
+  std::size_t second = 0;
+  using alloc = CopyPropagatingAllocator<std::pair<int, int>>;
+  s21::map<int, int, std::less<int>, alloc> m1{alloc(&first)};
+  s21::map<int, int, std::less<int>, alloc> m2{alloc(&second)};
+  for (int i = 0; i < 100; ++i) m1.insert(i, i);
+  m2.insert(-1, -1);
+  std::size_t before = first;
+  m2 = m1;
+  ASSERT_TRUE(m2.get_allocator() == alloc(&first));
+  ASSERT_GT(first, before);
+  ASSERT_EQ(m2.size(), 100U);
+  ASSERT_EQ(m2.contains(-1), false);
+  ASSERT_EQ(m2.at(99), 99);
+}
+
+TEST(map_alloc, copy_assign_01) {
+  ThrowingCopy::copiesLeft = 1000;
+  s21::map<int, ThrowingCopy> m1;
+  s21::map<int, ThrowingCopy> m2;
+  for (int i = 0; i < 100; ++i) m1.insert(i, ThrowingCopy(i));
+  m2.insert(-1, ThrowingCopy(-1));
+  ThrowingCopy::copiesLeft = 50;
+  EXPECT_THROW(m2 = m1, std::runtime_error);
+  ASSERT_EQ(m2.size(), 1U);
+  ASSERT_EQ(m2.at(-1).text, "-1");
+  ThrowingCopy::copiesLeft = 1000;
+  m2 = m1;
+  ASSERT_EQ(m2.size(), 100U);
+  ASSERT_EQ(m2.at(42).text, "42");
+}
+
+TEST(map_access, transparent_00) {
+  s21::map<std::string, int, std::less<>> m1{
+      {"One", 1}, {"Two", 2}, {"Three", 3}};
+  std::string_view key = "Two";
+  EXPECT_EQ(m1.at(key), 2);
+  EXPECT_EQ(m1.contains(key), true);
+  EXPECT_EQ(m1.contains(std::string_view("Four")), false);
+  EXPECT_EQ(m1.count(key), 1U);
+  EXPECT_EQ((*m1.find(key)).second, 2);
+  EXPECT_EQ((*m1.lower_bound(std::string_view("Thr"))).first, "Three");
+  EXPECT_EQ((*m1.upper_bound(std::string_view("Three"))).first, "Two");
+  const char* raw = "One";
+  EXPECT_EQ(m1.at(raw), 1);
+}
+
+struct CountedKey {
+  int value;
+  static inline std::size_t comparisons = 0;
+  friend bool operator<(const CountedKey& a, const CountedKey& b) {
+    ++comparisons;
+    return a.value < b.value;
+  }
+};
+
+TEST(map_access, at_01) {
+  const int n = 1 << 16;
+  s21::map<CountedKey, int> m1;
+  for (int i = 0; i < n; ++i) m1.insert(CountedKey{i}, i);
+  CountedKey::comparisons = 0;
+  for (int i = 0; i < n; i += 97) {
+    ASSERT_EQ(m1.at(CountedKey{i}), i);
+    ASSERT_EQ(m1.contains(CountedKey{i}), true);
+  }
+  // Two comparisons per level of an AVL tree of height <= 1.45 * log2(n).
+  std::size_t lookups = 2 * (n / 97 + 1);
+  ASSERT_LE(CountedKey::comparisons, lookups * 2 * 24);
+}
+
+TEST(map_access, at_02) {
+  s21::map<int, int> m1{{1, 10}, {3, 30}};
+  EXPECT_THROW(m1.at(2), std::out_of_range);
+  EXPECT_EQ(m1.contains(2), false);
+  m1[2] = 20;
+  EXPECT_EQ(m1.at(2), 20);
+  EXPECT_EQ(m1[3], 30);
+  EXPECT_EQ(m1.size(), 3U);
+}
+
+// Counts the mapped values built by default construction.
+struct DefaultCounted {
+  static int constructions;
+  DefaultCounted() { ++constructions; }
+  int value = 0;
+};
+
+int DefaultCounted::constructions = 0;
+
+TEST(map_access, subscript_00) {
+  s21::map<int, DefaultCounted> m1;
+  for (int i = 0; i < 64; ++i) m1[i].value = i;
+  ASSERT_EQ(DefaultCounted::constructions, 64);
+  for (int i = 0; i < 64; ++i) ASSERT_EQ(m1[i].value, i);
+  ASSERT_EQ(DefaultCounted::constructions, 64);
+  ASSERT_EQ(m1.size(), 64U);
+}
+
+TEST(map_access, rank_00) {
+  s21::map<std::string, int, std::less<>> m1{
+      {"b", 2}, {"d", 4}, {"a", 1}, {"c", 3}};
+  EXPECT_EQ((*m1.nth_element(2)).first, "c");
+  EXPECT_EQ(m1.rank("c"), 2U);
+  EXPECT_EQ(m1.rank(std::string_view("bb")), 2U);
+  EXPECT_EQ(m1.nth_element(4) == m1.end(), true);
+}
+
+TEST(map_compare, compare_00) {
+  s21::map<int, std::string, std::greater<int>> m1{
+      {1, "one"}, {3, "three"}, {2, "two"}};
+  auto it = m1.begin();
+  EXPECT_EQ((*it).first, 3);
+  EXPECT_EQ((*++it).first, 2);
+  EXPECT_EQ(m1.at(1), "one");
+  EXPECT_EQ((*m1.lower_bound(2)).first, 2);
+  EXPECT_EQ((*m1.upper_bound(2)).first, 1);
+  EXPECT_EQ(m1.key_comp()(3, 1), true);
+  EXPECT_EQ(m1.value_comp()({3, "a"}, {1, "b"}), true);
+  EXPECT_EQ(m1.value_comp()({1, "a"}, {3, "b"}), false);
+}
+
+TEST(map_compare, compare_01) {
+  using tree = s21::map<int, int>::tree_type;
+  EXPECT_EQ(sizeof(tree), 2 * sizeof(void*) + sizeof(s21::NodePool<int>));
+}
+
+TEST(map_modifiers, assign_sorted_00) {
+  std::map<int, std::string> source;
+  for (int i = 0; i < 1000; ++i) source[i] = std::to_string(i);
+  s21::map<int, std::string> m1(source.begin(), source.end());
+  ASSERT_EQ(m1.size(), source.size());
+  ASSERT_EQ(m1.at(999), "999");
+  std::vector<std::pair<int, std::string>> items{{3, "c"}, {1, "a"}, {3, "x"}};
+  m1.assign_sorted(items.begin(), items.end());
+  ASSERT_EQ(m1.size(), 2U);
+  ASSERT_EQ(m1.at(3), "c");
+  ASSERT_EQ((*m1.begin()).first, 1);
+}
+
+TEST(map_modifiers, pmr_move_assign_00) {
+  using alloc = std::pmr::polymorphic_allocator<std::pair<int, std::string>>;
+  using pmr_map = s21::map<int, std::string, std::less<int>, alloc>;
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  pmr_map m1{alloc(&first)};
+  pmr_map m2{alloc(&second)};
+  pmr_map m3{alloc(&first)};
+  for (int i = 0; i < 100; ++i) m1.insert(i, std::to_string(i));
+  m2 = std::move(m1);
+  ASSERT_EQ(m2.size(), 100U);
+  ASSERT_EQ(m2.at(42), "42");
+  ASSERT_EQ(m2.get_allocator().resource(), &second);
+  ASSERT_TRUE(m1.empty());
+  m3 = std::move(m2);
+  ASSERT_EQ(m3.size(), 100U);
+  ASSERT_EQ(m3.at(99), "99");
+  ASSERT_EQ(m3.get_allocator().resource(), &first);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+// Allocator that tags its blocks with an id and propagates on every
+// operation, so that the tests can see which allocator a vector holds.
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit TaggedAllocator(int tag_ = 0) : tag(tag_) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+
+  T *allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  friend bool operator==(const TaggedAllocator &a, const TaggedAllocator &b) {
+    return a.tag == b.tag;
+  }
+  friend bool operator!=(const TaggedAllocator &a, const TaggedAllocator &b) {
+    return a.tag != b.tag;
+  }
+
+  int tag;
+};
+}  // namespace
+
+TEST(TestMemoryResource, Monotonic_1) {
+  alignas(std::max_align_t) char buffer[4096];
+  s21::pmr::monotonic_resource arena(buffer, sizeof(buffer),
+                                     std::pmr::null_memory_resource());
+  s21::pmr::vector<int> vector1(&arena);
+  for (int i = 0; i < 200; i++) vector1.push_back(i);
+  EXPECT_EQ(vector1.size(), (size_t)200);
+  EXPECT_EQ(vector1[199], 199);
+  char *p = reinterpret_cast<char *>(vector1.data());
+  EXPECT_TRUE(p >= buffer && p < buffer + sizeof(buffer));
+  EXPECT_THROW(vector1.reserve(10000), std::bad_alloc);
+  EXPECT_EQ(vector1.get_allocator().resource(), &arena);
+}
+
+TEST(TestMemoryResource, Monotonic_2) {
+  s21::pmr::monotonic_resource arena(64);
+  s21::pmr::vector<std::string> vector1(&arena);
+  for (int i = 0; i < 1000; i++) vector1.push_back(std::to_string(i));
+  EXPECT_EQ(vector1[999], "999");
+  void *a = arena.allocate(3, 1);
+  void *b = arena.allocate(8, 8);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 8, (uintptr_t)0);
+  EXPECT_NE(a, b);
+  vector1 = s21::pmr::vector<std::string>(&arena);
+  arena.release();
+}
+
+TEST(TestMemoryResource, Pool_1) {
+  s21::pmr::pool_resource pool;
+  void *a = pool.allocate(24, 8);
+  pool.deallocate(a, 24, 8);
+  EXPECT_EQ(pool.allocate(30, 8), a);
+  void *big = pool.allocate(100000, 16);
+  pool.deallocate(big, 100000, 16);
+  s21::pmr::vector<double> vector1(&pool);
+  s21::pmr::vector<double> vector2(&pool);
+  for (int i = 0; i < 100; i++) {
+    vector1.push_back(i);
+    vector2.insert(vector2.begin(), i);
+  }
+  EXPECT_EQ(vector1.sum(), vector2.sum());
+  EXPECT_EQ(vector2.front(), 99);
+  for (size_t size = 1; size <= 4096; size *= 2) {
+    void *p = pool.allocate(size, std::min<size_t>(size, 16));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % std::min<size_t>(size, 16),
+              (uintptr_t)0);
+  }
+}
+
+TEST(TestMemoryResource, Propagation_1) {
+  s21::pmr::monotonic_resource arena1;
+  s21::pmr::monotonic_resource arena2;
+  s21::pmr::vector<std::string> vector1({"a", "b"}, &arena1);
+  s21::pmr::vector<std::string> vector2(&arena2);
+  vector2 = vector1;
+  EXPECT_EQ(vector2.get_allocator().resource(), &arena2);
+  vector2 = std::move(vector1);
+  EXPECT_EQ(vector2.get_allocator().resource(), &arena2);
+  EXPECT_EQ(vector2[1], "b");
+  s21::pmr::vector<std::string> vector3(vector2);
+  EXPECT_EQ(vector3.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  s21::pmr::vector<std::string> vector4(std::move(vector2), &arena1);
+  EXPECT_EQ(vector4.get_allocator().resource(), &arena1);
+  EXPECT_EQ(vector4[0], "a");
+}
+
+TEST(TestMemoryResource, Propagation_2) {
+  using Vector = s21::vector<std::string, TaggedAllocator<std::string>>;
+  Vector vector1({"a", "b"}, TaggedAllocator<std::string>(1));
+  Vector vector2(TaggedAllocator<std::string>(2));
+  vector2 = vector1;
+  EXPECT_EQ(vector2.get_allocator().tag, 1);
+  Vector vector3(TaggedAllocator<std::string>(3));
+  vector3.swap(vector2);
+  EXPECT_EQ(vector3.get_allocator().tag, 1);
+  EXPECT_EQ(vector2.get_allocator().tag, 3);
+  vector2 = std::move(vector3);
+  EXPECT_EQ(vector2.get_allocator().tag, 1);
+  EXPECT_EQ(vector2[0], "a");
+}
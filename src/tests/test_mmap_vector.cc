@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace {
+struct Point {
+  int32_t x;
+  int32_t y;
+};
+
+// Path of a scratch file removed when the test ends.
+class TempFile {
+ public:
+  explicit TempFile(const std::string &name)
+      : path_(testing::TempDir() + "s21_" + name) {
+    std::remove(path_.c_str());
+  }
+  ~TempFile() { std::remove(path_.c_str()); }
+  const std::string &path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+}  // namespace
+
+TEST(MmapVector, Persist_1) {
+  TempFile file("mmap_persist.bin");
+  {
+    s21::mmap_vector<Point> v(file.path());
+    EXPECT_TRUE(v.empty());
+    for (int32_t i = 0; i < 1000; ++i) v.push_back({i, -i});
+    v.emplace_back(Point{7, 8});
+    EXPECT_EQ(v.size(), 1001U);
+    v.flush();
+  }
+  s21::mmap_vector<Point> v(file.path());
+  ASSERT_EQ(v.size(), 1001U);
+  EXPECT_EQ(v[500].x, 500);
+  EXPECT_EQ(v.at(999).y, -999);
+  EXPECT_EQ(v.back().y, 8);
+  int64_t sum = 0;
+  for (const Point &p : v) sum += p.x;
+  EXPECT_EQ(sum, 999 * 1000 / 2 + 7);
+  EXPECT_THROW(v.at(1001), std::out_of_range);
+}
+
+TEST(MmapVector, ReadOnly_1) {
+  TempFile file("mmap_read_only.bin");
+  {
+    s21::mmap_vector<int> v(file.path());
+    v.reserve(100);
+    v.resize(10, 3);
+    v.insert(v.begin(), 1);
+    v.erase(v.end() - 2, v.end());
+  }
+  s21::mmap_vector<int> v(file.path(), s21::mmap_mode::read_only);
+  EXPECT_TRUE(v.is_read_only());
+  ASSERT_EQ(v.size(), 9U);
+  EXPECT_EQ(v.capacity(), 9U);
+  EXPECT_EQ(v.front(), 1);
+  s21::span<const int> view = v;
+  EXPECT_EQ(view.size(), 9U);
+  EXPECT_EQ(view[8], 3);
+  EXPECT_THROW(v.push_back(1), std::logic_error);
+  EXPECT_THROW(v.reserve(50), std::logic_error);
+  EXPECT_THROW(v.flush(), std::logic_error);
+}
+
+TEST(MmapVector, Growth_1) {
+  TempFile file("mmap_growth.bin");
+  s21::mmap_vector<uint64_t> v(file.path());
+  s21::vector<uint64_t> expected;
+  for (uint64_t i = 0; i < 100000; ++i) {
+    v.push_back(i * i);
+    expected.push_back(i * i);
+  }
+  EXPECT_GE(v.capacity(), v.size());
+  ASSERT_EQ(v.size(), expected.size());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin()));
+  v.erase(v.begin() + 10, v.end());
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 10U);
+  EXPECT_EQ(v[9], 81U);
+  v.resize(11, 7);
+  EXPECT_EQ(v.capacity(), 20U);
+  EXPECT_EQ(v[10], 7U);
+  v.resize(100);
+  EXPECT_EQ(v.capacity(), 100U);
+  v.pop_back();
+  v.clear();
+  EXPECT_THROW(v.pop_back(), std::length_error);
+}
+
+TEST(MmapVector, Errors_1) {
+  TempFile file("mmap_errors.bin");
+  EXPECT_THROW(
+      s21::mmap_vector<int>(file.path(), s21::mmap_mode::read_only),
+      std::system_error);
+  { std::ofstream(file.path()) << "not a vector file, just some text here"; }
+  EXPECT_THROW(s21::mmap_vector<int>{file.path()}, std::runtime_error);
+  std::remove(file.path().c_str());
+  { s21::mmap_vector<int>(file.path()).push_back(1); }
+  EXPECT_THROW(s21::mmap_vector<Point>{file.path()}, std::runtime_error);
+}
+
+TEST(MmapVector, Move_1) {
+  TempFile file("mmap_move.bin");
+  s21::mmap_vector<int> a(file.path());
+  a.push_back(42);
+  s21::mmap_vector<int> b(std::move(a));
+  EXPECT_FALSE(a.is_open());
+  EXPECT_THROW(a.push_back(1), std::logic_error);
+  EXPECT_EQ(b[0], 42);
+  a = std::move(b);
+  EXPECT_EQ(a.size(), 1U);
+  a.close();
+  EXPECT_EQ(a.size(), 0U);
+}
@@ -109,4 +109,75 @@ TEST(multiset_mod, insert_02) {
   EXPECT_EQ(ms1.contains(5), true);
   EXPECT_EQ(ms1.contains(6), true);
   EXPECT_EQ(ms1.contains(99), true);
-}
\ No newline at end of file
+}
+TEST(multiset_mod, insert_03) {
+  s21::multiset<int> ms1{10, 20, 30, 40};
+  s21::multiset<int>::iterator it = ms1.insert(25);
+  ASSERT_EQ((*it), 25);
+  it = ms1.insert(20);
+  ASSERT_EQ((*it), 20);
+  ASSERT_EQ(ms1.count(20), 2U);
+}
+
+TEST(multiset_iter, Iterators_01) {
+  s21::multiset<int> ms1;
+  for (int i = 0; i < 500; ++i) ms1.insert(i % 250);
+  s21::multiset<int> ms2(ms1);
+  auto it = ms2.begin();
+  for (int i = 0; i < 499; ++i) ++it;
+  ASSERT_EQ(*it, 249);
+  for (int i = 498; i >= 0; --i) ASSERT_EQ(*--it, i / 2);
+}
+
+TEST(multiset_access, transparent_00) {
+  s21::multiset<std::string, std::less<>> ms{"a", "b", "b", "c"};
+  EXPECT_EQ(ms.count(std::string_view("b")), 2U);
+  auto range = ms.equal_range(std::string_view("b"));
+  EXPECT_EQ(*range.first, "b");
+  EXPECT_EQ(*range.second, "c");
+}
+
+TEST(multiset_access, count_01) {
+  s21::multiset<int> ms;
+  std::multiset<int> std_ms;
+  for (int i = 0; i < 1000; ++i) {
+    ms.insert(i % 17);
+    std_ms.insert(i % 17);
+  }
+  for (int i = 0; i < 100; ++i) ms.erase(ms.find(i % 5));
+  for (int i = 0; i < 100; ++i) std_ms.erase(std_ms.find(i % 5));
+  for (int key = -1; key <= 17; ++key) {
+    ASSERT_EQ(ms.count(key), std_ms.count(key));
+    ASSERT_EQ(ms.rank(key), static_cast<std::size_t>(std::distance(
+                                std_ms.begin(), std_ms.lower_bound(key))));
+  }
+  ASSERT_EQ(*ms.nth_element(0), 0);
+  ASSERT_EQ(*ms.nth_element(ms.size() - 1), 16);
+}
+
+TEST(multiset_compare, compare_00) {
+  s21::multiset<int, std::greater<int>> ms{1, 5, 3, 5, 2};
+  auto it = ms.begin();
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(*++it, 5);
+  EXPECT_EQ(*++it, 3);
+  EXPECT_EQ(ms.count(5), 2U);
+  EXPECT_EQ(*ms.lower_bound(4), 3);
+  EXPECT_EQ(ms.rank(3), 2U);
+}
+
+TEST(multiset_modifiers, assign_sorted_00) {
+  std::vector<int> keys{5, 1, 5, 3, 1, 5};
+  s21::multiset<int> ms(keys.begin(), keys.end());
+  ASSERT_EQ(ms.size(), 6U);
+  ASSERT_EQ(ms.count(5), 3U);
+  std::sort(keys.begin(), keys.end());
+  auto it = ms.begin();
+  for (int key : keys) {
+    ASSERT_EQ(*it, key);
+    ++it;
+  }
+  ms.assign_sorted(keys.begin(), keys.begin() + 2);
+  ASSERT_EQ(ms.size(), 2U);
+  ASSERT_EQ(ms.count(1), 2U);
+}
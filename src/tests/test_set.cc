@@ -116,4 +116,116 @@ TEST(set_mod, insert_02) {
   EXPECT_EQ(s1.contains(5), true);
   EXPECT_EQ(s1.contains(6), true);
   EXPECT_EQ(s1.contains(99), true);
-}
\ No newline at end of file
+}
+template <typename Node>
+int avl_height(const Node *node) {
+  if (node == nullptr) return 0;
+  int left = avl_height(node->left);
+  int right = avl_height(node->right);
+  if (left < 0 || right < 0 || std::abs(right - left) > 1) return -1;
+  if (node->left && node->left->parent != node) return -1;
+  if (node->right && node->right->parent != node) return -1;
+  std::size_t size = 1;
+  if (node->left) size += node->left->subtreeSize;
+  if (node->right) size += node->right->subtreeSize;
+  if (size != node->subtreeSize) return -1;
+  int height = 1 + std::max(left, right);
+  return height == static_cast<int>(node->height) ? height : -1;
+}
+
+TEST(set_balance, avl_00) {
+  s21::BinaryTree<int, int, s21::set<int>::setCompare> tree;
+  for (int i = 0; i < 4096; ++i) tree.insertUnique(i);
+  ASSERT_EQ(avl_height(tree.getRoot()), 13);
+  for (int i = 0; i < 4096; i += 2) tree.erase(tree.find(i));
+  ASSERT_EQ(tree.size(), 2048U);
+  ASSERT_GT(avl_height(tree.getRoot()), 0);
+  ASSERT_LE(avl_height(tree.getRoot()), 12);
+}
+
+TEST(set_balance, avl_01) {
+  s21::BinaryTree<int, int, s21::set<int>::setCompare> tree;
+  for (int i = 0; i < 1000; ++i) tree.insertUnique((i * 7919) % 1000);
+  for (int i = 0; i < 1000; ++i) {
+    tree.erase(tree.find((i * 31) % 1000));
+    ASSERT_GE(avl_height(tree.getRoot()), 0);
+  }
+  ASSERT_EQ(tree.empty(), true);
+}
+
+TEST(set_balance, build_00) {
+  s21::BinaryTree<int, int, s21::set<int>::setCompare> tree;
+  std::vector<int> keys;
+  for (int i = 0; i < 5000; ++i) keys.push_back(i / 2);
+  tree.assignSorted(keys.begin(), keys.end(), true);
+  ASSERT_EQ(tree.size(), 2500U);
+  ASSERT_EQ(avl_height(tree.getRoot()), 12);
+  std::reverse(keys.begin(), keys.end());
+  tree.assignSorted(keys.begin(), keys.end(), false);
+  ASSERT_EQ(tree.size(), 5000U);
+  ASSERT_EQ(avl_height(tree.getRoot()), 13);
+  tree.insertUnique(5000);
+  tree.erase(tree.find(0));
+  ASSERT_GT(avl_height(tree.getRoot()), 0);
+}
+
+TEST(set_mod, assign_sorted_00) {
+  std::vector<std::string> keys{"d", "a", "c", "a", "b"};
+  s21::set<std::string> s1(keys.begin(), keys.end());
+  ASSERT_EQ(s1.size(), 4U);
+  std::string joined;
+  for (auto it = s1.begin(); it != s1.end(); ++it) joined += *it;
+  ASSERT_EQ(joined, "abcd");
+  s1.assign_sorted(keys.begin(), keys.begin() + 1);
+  ASSERT_EQ(s1.size(), 1U);
+  ASSERT_EQ(s1.contains("d"), true);
+}
+
+TEST(set_access, transparent_00) {
+  s21::set<std::string, std::less<>> s1{"alpha", "beta", "gamma"};
+  std::string_view key = "beta";
+  EXPECT_EQ(s1.contains(key), true);
+  EXPECT_EQ(s1.count(std::string_view("delta")), 0U);
+  EXPECT_EQ(*s1.find(key), "beta");
+  EXPECT_EQ(*s1.lower_bound(std::string_view("b")), "beta");
+  EXPECT_EQ(*s1.upper_bound(key), "gamma");
+}
+
+TEST(set_access, rank_00) {
+  s21::set<int> s1;
+  std::set<int> s2;
+  for (int i = 0; i < 300; ++i) {
+    s1.insert((i * 37) % 1000);
+    s2.insert((i * 37) % 1000);
+  }
+  for (int i = 0; i < 300; i += 3) s1.erase(s1.find((i * 37) % 1000));
+  for (int i = 0; i < 300; i += 3) s2.erase((i * 37) % 1000);
+  std::size_t index = 0;
+  for (int value : s2) {
+    ASSERT_EQ(*s1.nth_element(index), value);
+    ASSERT_EQ(s1.rank(value), index);
+    ++index;
+  }
+  ASSERT_EQ(s1.nth_element(s2.size()) == s1.end(), true);
+  ASSERT_EQ(s1.rank(-1), 0U);
+  ASSERT_EQ(s1.rank(1000), s2.size());
+}
+
+struct ModuloLess {
+  int modulo;
+  bool operator()(int a, int b) const { return a % modulo < b % modulo; }
+};
+
+TEST(set_compare, compare_00) {
+  s21::set<int, ModuloLess> s1(ModuloLess{10});
+  s1.insert(13);
+  s1.insert(21);
+  s1.insert(33);
+  s1.insert(5);
+  EXPECT_EQ(s1.size(), 3U);
+  EXPECT_EQ(*s1.begin(), 21);
+  EXPECT_EQ(s1.contains(43), true);
+  s21::set<int, ModuloLess> s2(s1);
+  EXPECT_EQ(*s2.find(3), 13);
+  EXPECT_EQ(s2.key_comp().modulo, 10);
+}
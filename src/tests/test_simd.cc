@@ -0,0 +1,102 @@
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "../s21_simd.h"
+#include "gtest/gtest.h"
+
+namespace {
+// Runs the kernels of one instruction set over every length up to 100 and
+// every position of a planted value, so that full registers and tails are
+// both covered.
+template <typename T, typename Kernels>
+void checkKernels(Kernels kernels) {
+  for (size_t n = 1; n <= 100; n++) {
+    std::vector<T> data(n);
+    for (size_t i = 0; i < n; i++) data[i] = static_cast<T>(i % 50 + 2);
+    for (size_t pos = 0; pos < n; pos++) {
+      std::vector<T> copy(data);
+      copy[pos] = static_cast<T>(1);
+      ASSERT_EQ(kernels.find(copy.data(), n, T(1)), pos);
+      ASSERT_EQ(kernels.min(copy.data(), n), T(1));
+      ASSERT_FALSE(kernels.equal(copy.data(), data.data(), n));
+      copy[pos] = static_cast<T>(60);
+      ASSERT_EQ(kernels.max(copy.data(), n), T(60));
+    }
+    ASSERT_EQ(kernels.find(data.data(), n, T(0)), n);
+    ASSERT_TRUE(kernels.equal(data.data(), data.data(), n));
+    auto expected = std::accumulate(data.begin(), data.end(),
+                                    typename s21::simd_sum<T>::type());
+    ASSERT_EQ(kernels.sum(data.data(), n), expected);
+
+    std::vector<T> other(n);
+    kernels.fill(other.data(), n, T(9));
+    for (T value : other) ASSERT_EQ(value, T(9));
+    kernels.swap_ranges(data.data(), other.data(), n);
+    ASSERT_EQ(data[n - 1], T(9));
+    ASSERT_EQ(other[0], T(2));
+  }
+}
+
+template <typename T>
+void checkAll() {
+  struct Dispatch {
+    void fill(T *p, size_t n, T v) { s21::simd::fill(p, n, v); }
+    void swap_ranges(T *a, T *b, size_t n) { s21::simd::swap_ranges(a, b, n); }
+    bool equal(const T *a, const T *b, size_t n) {
+      return s21::simd::equal(a, b, n);
+    }
+    size_t find(const T *p, size_t n, T v) { return s21::simd::find(p, n, v); }
+    T min(const T *p, size_t n) { return s21::simd::min(p, n); }
+    T max(const T *p, size_t n) { return s21::simd::max(p, n); }
+    auto sum(const T *p, size_t n) { return s21::simd::sum(p, n); }
+  };
+  checkKernels<T>(Dispatch());
+#ifdef S21_SIMD_X86
+  // Only the AVX2 set runs through dispatch on most machines.
+  if constexpr (s21::simd::kVectorized<T>) {
+    struct Sse2 {
+      void fill(T *p, size_t n, T v) { s21::simd_detail::sse2::fill(p, n, v); }
+      void swap_ranges(T *a, T *b, size_t n) {
+        s21::simd_detail::sse2::swap_ranges(a, b, n);
+      }
+      bool equal(const T *a, const T *b, size_t n) {
+        return s21::simd_detail::sse2::equal(a, b, n);
+      }
+      size_t find(const T *p, size_t n, T v) {
+        return s21::simd_detail::sse2::find(p, n, v);
+      }
+      T min(const T *p, size_t n) { return s21::simd_detail::sse2::min(p, n); }
+      T max(const T *p, size_t n) { return s21::simd_detail::sse2::max(p, n); }
+      auto sum(const T *p, size_t n) {
+        return s21::simd_detail::sse2::sum(p, n);
+      }
+    };
+    checkKernels<T>(Sse2());
+  }
+#endif
+}
+}  // namespace
+
+TEST(TestSimd, Int32_1) { checkAll<int32_t>(); }
+
+TEST(TestSimd, Float_1) { checkAll<float>(); }
+
+TEST(TestSimd, Uint8_1) { checkAll<uint8_t>(); }
+
+TEST(TestSimd, Scalar_1) { checkAll<int64_t>(); }
+
+TEST(TestSimd, Negative_1) {
+  std::vector<int32_t> data = {5, -3, 7, -2147483647 - 1, 2147483647,
+                               0, 1,  -1, 8};
+  EXPECT_EQ(s21::simd::min(data.data(), data.size()), -2147483647 - 1);
+  EXPECT_EQ(s21::simd::max(data.data(), data.size()), 2147483647);
+  EXPECT_EQ(s21::simd::sum(data.data(), data.size()), (int64_t)16);
+  std::vector<float> floats = {0.0f, -0.0f, 1.5f, 2.5f, 0.5f,
+                               1.0f, 2.0f, 3.0f, NAN};
+  std::vector<float> copy(floats);
+  EXPECT_FALSE(s21::simd::equal(floats.data(), copy.data(), floats.size()));
+  EXPECT_TRUE(s21::simd::equal(floats.data(), copy.data(), 8));
+  EXPECT_EQ(s21::simd::find(floats.data(), 8, -0.0f), (size_t)0);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace {
+template <typename V>
+void expectSame(const V &v, const std::vector<typename V::value_type> &ref) {
+  ASSERT_EQ(v.size(), ref.size());
+  for (size_t i = 0; i < ref.size(); i++) EXPECT_EQ(v[i], ref[i]);
+}
+
+template <typename V, typename Arg, typename = void>
+struct CanInsertMany : std::false_type {};
+
+template <typename V, typename Arg>
+struct CanInsertMany<
+    V, Arg,
+    std::void_t<decltype(std::declval<V &>().insert_many(
+        std::declval<const V &>().begin(), std::declval<Arg>()))>>
+    : std::true_type {};
+}  // namespace
+
+TEST(TestSmallVector, Inline_1) {
+  s21::small_vector<int, 4> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), (size_t)4);
+  v.insert_many_back(1, 2, 3, 4);
+  EXPECT_TRUE(v.is_inline());
+  v.push_back(5);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), (size_t)8);
+  expectSame(v, {1, 2, 3, 4, 5});
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  expectSame(v, {1, 2, 3, 4});
+  v.reserve(100);
+  EXPECT_EQ(v.capacity(), (size_t)100);
+  expectSame(v, {1, 2, 3, 4});
+  EXPECT_THROW(v.at(4), std::out_of_range);
+}
+
+TEST(TestSmallVector, Resize_1) {
+  s21::small_vector<int, 4> v(4);
+  v.reserve(6);
+  v.resize(7);
+  EXPECT_EQ(v.capacity(), (size_t)12);
+  v.resize(30, 1);
+  EXPECT_EQ(v.capacity(), (size_t)30);
+  EXPECT_EQ(v[6], 0);
+  EXPECT_EQ(v[29], 1);
+}
+
+TEST(TestSmallVector, Insert_1) {
+  s21::small_vector<std::string, 3> v = {"a", "d"};
+  std::vector<std::string> items = {"b", "c"};
+  v.insert(v.begin() + 1, items.begin(), items.end());
+  EXPECT_FALSE(v.is_inline());
+  expectSame(v, {"a", "b", "c", "d"});
+  v.insert(v.begin(), 2, v[3]);
+  v.insert_many(v.end() - 1, "x", "y");
+  v.emplace(v.begin() + 1, 3, 'z');
+  expectSame(v, {"d", "zzz", "d", "a", "b", "c", "x", "y", "d"});
+  v.erase(v.begin(), v.begin() + 6);
+  expectSame(v, {"x", "y", "d"});
+  v.resize(5, "r");
+  expectSame(v, {"x", "y", "d", "r", "r"});
+  EXPECT_THROW(v.erase(v.end()), std::length_error);
+}
+
+TEST(TestSmallVector, Insert_2) {
+  using V = s21::small_vector<long, 4>;
+  static_assert(!CanInsertMany<V, long *>::value);
+  static_assert(CanInsertMany<V, int>::value);
+  s21::small_vector<std::unique_ptr<int>, 2> v;
+  v.insert_many_back(new int(1), new int(3));
+  v.insert_many(v.begin() + 1, new int(2));
+  ASSERT_EQ(v.size(), 3u);
+  EXPECT_EQ(*v[0], 1);
+  EXPECT_EQ(*v[1], 2);
+  EXPECT_EQ(*v[2], 3);
+}
+
+TEST(TestSmallVector, Move_1) {
+  s21::small_vector<std::unique_ptr<int>, 2> inl;
+  inl.push_back(std::make_unique<int>(1));
+  s21::small_vector<std::unique_ptr<int>, 2> heap;
+  for (int i = 0; i < 5; i++) heap.push_back(std::make_unique<int>(10 + i));
+  const std::unique_ptr<int> *buffer = heap.data();
+
+  s21::small_vector<std::unique_ptr<int>, 2> moved(std::move(heap));
+  EXPECT_EQ(moved.data(), buffer);
+  EXPECT_TRUE(heap.empty());
+  EXPECT_TRUE(heap.is_inline());
+  heap = std::move(inl);
+  EXPECT_TRUE(heap.is_inline());
+  ASSERT_EQ(heap.size(), (size_t)1);
+  EXPECT_EQ(*heap[0], 1);
+  EXPECT_TRUE(inl.empty());
+  heap.push_back(std::make_unique<int>(2));
+  heap.push_back(std::make_unique<int>(3));
+  EXPECT_EQ(*heap.back(), 3);
+}
+
+TEST(TestSmallVector, Swap_1) {
+  s21::small_vector<std::string, 2> a = {"a"};
+  s21::small_vector<std::string, 2> b = {"b", "c", "d"};
+  a.swap(b);
+  EXPECT_FALSE(a.is_inline());
+  EXPECT_TRUE(b.is_inline());
+  expectSame(a, {"b", "c", "d"});
+  expectSame(b, {"a"});
+  s21::small_vector<std::string, 2> c = {"e", "f", "g", "h"};
+  a.swap(c);
+  expectSame(a, {"e", "f", "g", "h"});
+  expectSame(c, {"b", "c", "d"});
+  s21::small_vector<std::string, 2> d = {"i", "j"};
+  b.swap(d);
+  expectSame(b, {"i", "j"});
+  expectSame(d, {"a"});
+  b = c;
+  expectSame(b, {"b", "c", "d"});
+  expectSame(c, {"b", "c", "d"});
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "../s21_span.h"
+#include "test_utils.h"
+
+namespace {
+using s21_test::CountingResource;
+using s21_test::DefaultResourceGuard;
+
+int sum(s21::span<const int> values) {
+  int result = 0;
+  for (int value : values) result += value;
+  return result;
+}
+}  // namespace
+
+TEST(TestSpan, Extent_1) {
+  int items[] = {1, 2, 3, 4, 5, 6};
+  s21::span all(items);
+  static_assert(decltype(all)::extent == 6);
+  static_assert(sizeof(all) == sizeof(int *));
+  static_assert(sizeof(s21::span<int>) == sizeof(int *) + sizeof(size_t));
+  auto head = all.first<2>();
+  static_assert(decltype(head)::extent == 2);
+  auto tail = all.subspan<2>();
+  static_assert(decltype(tail)::extent == 4);
+  EXPECT_EQ(tail[0], 3);
+  EXPECT_EQ(all.last<1>()[0], 6);
+  s21::span<int> dynamic = all;
+  EXPECT_EQ(dynamic.size(), (size_t)6);
+  EXPECT_EQ(dynamic.subspan(1, 3).back(), 4);
+  EXPECT_EQ(dynamic.subspan(6).size(), (size_t)0);
+  EXPECT_TRUE(dynamic.last(0).empty());
+  EXPECT_EQ(s21::as_bytes(all).size(), 6 * sizeof(int));
+  s21::as_writable_bytes(dynamic.first(1))[0] = std::byte{9};
+  EXPECT_EQ(items[0] & 0xFF, 9);
+  s21::span<int> none;
+  EXPECT_TRUE(none.empty());
+}
+
+TEST(TestSpan, Constructors_1) {
+  int items[] = {1, 2, 3, 4};
+  int *p = items;
+  s21::span<int> empty(p, 0);
+  EXPECT_TRUE(empty.empty());
+  s21::span<int> pair(p, p + 3);
+  EXPECT_EQ(pair.size(), (size_t)3);
+  using fixed4 = s21::span<int, 4>;
+  static_assert(!std::is_convertible<s21::span<int>, fixed4>::value);
+  static_assert(std::is_constructible<fixed4, s21::span<int>>::value);
+  static_assert(std::is_convertible<fixed4, s21::span<int>>::value);
+  s21::span<int> dynamic(items);
+  s21::span<const int, 4> fixed(dynamic);
+  EXPECT_EQ(fixed[3], 4);
+}
+
+TEST(TestSpan, Containers_1) {
+  s21::vector<int> vector1 = {1, 2, 3, 4};
+  EXPECT_EQ(sum(vector1), 10);
+  s21::span<int> view = vector1;
+  view[0] = 10;
+  EXPECT_EQ(vector1[0], 10);
+  const s21::vector<int> &constant = vector1;
+  s21::span<const int> constView = constant;
+  EXPECT_EQ(constView.data(), vector1.data());
+
+  s21::array<int, 3> array1 = {1, 2, 3};
+  s21::span<int, 3> fixed = array1;
+  s21::span<const int> loose = array1;
+  EXPECT_EQ(fixed.data(), array1.data());
+  EXPECT_EQ(sum(array1), 6);
+  EXPECT_EQ(loose.size(), (size_t)3);
+  std::array<int, 2> array2 = {5, 6};
+  EXPECT_EQ(sum(array2), 11);
+
+  vector1.insert(vector1.begin() + 1, s21::span<const int>(array1));
+  vector1.insert(vector1.end(), loose.last(1));
+  s21::vector<int> expected = {10, 1, 2, 3, 2, 3, 4, 3};
+  EXPECT_TRUE(vector1 == expected);
+  s21::vector<std::string> vector2 = {"a", "b"};
+  std::string words[] = {"x", "y", "z"};
+  vector2.assign(s21::span<const std::string>(words).subspan(1));
+  ASSERT_EQ(vector2.size(), (size_t)2);
+  EXPECT_EQ(vector2[0], "y");
+  vector2.assign(3, vector2[1]);
+  EXPECT_EQ(vector2.size(), (size_t)3);
+  EXPECT_EQ(vector2[2], "z");
+  vector2.assign({"q"});
+  EXPECT_EQ(vector2.back(), "q");
+}
+
+TEST(TestSpan, SelfInsert_1) {
+  s21::vector<std::string> vector1 = {"a", "b", "c"};
+  vector1.shrink_to_fit();
+  vector1.insert(vector1.end(), vector1);
+  s21::vector<std::string> expected = {"a", "b", "c", "a", "b", "c"};
+  EXPECT_TRUE(vector1 == expected);
+  s21::span<const std::string> middle = s21::span<std::string>(vector1);
+  vector1.insert(vector1.begin(), middle.subspan(2, 2));
+  expected = {"c", "a", "a", "b", "c", "a", "b", "c"};
+  EXPECT_TRUE(vector1 == expected);
+  vector1.assign(s21::span<std::string>(vector1).last(3));
+  expected = {"a", "b", "c"};
+  EXPECT_TRUE(vector1 == expected);
+}
+
+// Slicing only computes pointers: a 1 GiB buffer is cut into views without
+// a single allocation. The buffer is never written, so its pages are not
+// committed.
+TEST(TestSpan, NoAllocation_1) {
+  CountingResource counting;
+  DefaultResourceGuard guard(&counting);
+  s21::pmr::vector<uint8_t> buffer(&counting);
+  buffer.resize_for_overwrite(size_t(1) << 30);
+  ASSERT_EQ(counting.allocations, (size_t)1);
+  s21::span<const uint8_t> whole = buffer;
+  size_t total = 0;
+  for (size_t offset = 0; offset < whole.size(); offset += 1 << 20) {
+    s21::span<const uint8_t> chunk = whole.subspan(offset, 1 << 20);
+    total += chunk.first(4096).size() + chunk.last(4096).size();
+  }
+  EXPECT_EQ(total, size_t(1024) * 8192);
+  EXPECT_EQ(whole.subspan(whole.size() / 2).size(), size_t(1) << 29);
+  EXPECT_EQ(counting.allocations, (size_t)1);
+}
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../s21_containersplus.h"
+
+TEST(unordered_map_capacity, empty_00) {
+  s21::unordered_map<int, int> m1;
+  ASSERT_EQ(m1.empty(), true);
+  ASSERT_EQ(m1.size(), 0U);
+  ASSERT_EQ(m1.begin() == m1.end(), true);
+  ASSERT_EQ(m1.contains(1), false);
+}
+
+TEST(unordered_map_main, init_00) {
+  s21::unordered_map<int, std::string> m1{{1, "one"}, {2, "two"}, {1, "x"}};
+  ASSERT_EQ(m1.size(), 2U);
+  ASSERT_EQ(m1.at(1), "one");
+  ASSERT_THROW(m1.at(3), std::out_of_range);
+  m1[3] = "three";
+  ASSERT_EQ(m1.at(3), "three");
+}
+
+TEST(unordered_map_mod, insert_00) {
+  s21::unordered_map<int, int> m1;
+  std::unordered_map<int, int> m2;
+  for (int i = 0; i < 10000; ++i) {
+    int key = (i * 7919) % 5003;
+    ASSERT_EQ(m1.insert(key, i).second, m2.emplace(key, i).second);
+  }
+  ASSERT_EQ(m1.size(), m2.size());
+  for (auto& [key, value] : m2) ASSERT_EQ(m1.at(key), value);
+  ASSERT_LE(m1.load_factor(), 0.875f);
+}
+
+TEST(unordered_map_mod, erase_00) {
+  s21::unordered_map<int, int> m1;
+  for (int i = 0; i < 1000; ++i) m1.insert(i, i);
+  for (int round = 0; round < 20; ++round) {
+    for (int i = 0; i < 1000; i += 2) ASSERT_EQ(m1.erase(i), 1U);
+    for (int i = 0; i < 1000; i += 2) m1.insert(i, round);
+  }
+  ASSERT_EQ(m1.size(), 1000U);
+  ASSERT_EQ(m1.at(998), 19);
+  ASSERT_EQ(m1.erase(5000), 0U);
+  m1.erase(m1.find(1));
+  ASSERT_EQ(m1.contains(1), false);
+  std::size_t visited = 0;
+  for (auto it = m1.begin(); it != m1.end(); ++it) ++visited;
+  ASSERT_EQ(visited, 999U);
+}
+
+TEST(unordered_map_mod, insert_or_assign_00) {
+  s21::unordered_map<std::string, int> m1;
+  m1.insert_or_assign("abc", 123);
+  m1.insert_or_assign("abc", 321);
+  ASSERT_EQ(m1.at("abc"), 321);
+  auto result = m1.insert_many(std::make_pair(std::string("a"), 1),
+                               std::make_pair(std::string("abc"), 2));
+  ASSERT_EQ(result.size(), 2U);
+  ASSERT_EQ(result[0].second, true);
+  ASSERT_EQ(result[1].second, false);
+  ASSERT_EQ(result[1].first->second, 321);
+}
+
+TEST(unordered_map_mod, merge_00) {
+  s21::unordered_map<int, int> m1{{1, 1}, {2, 2}};
+  s21::unordered_map<int, int> m2{{2, 20}, {3, 30}};
+  m1.merge(m2);
+  ASSERT_EQ(m1.size(), 3U);
+  ASSERT_EQ(m1.at(2), 2);
+  ASSERT_EQ(m1.at(3), 30);
+  ASSERT_EQ(m2.size(), 1U);
+  ASSERT_EQ(m2.at(2), 20);
+}
+
+TEST(unordered_map_main, copy_00) {
+  s21::unordered_map<std::string, std::string> m1;
+  for (int i = 0; i < 100; ++i) m1[std::to_string(i)] = std::string(30, 'y');
+  s21::unordered_map<std::string, std::string> m2(m1);
+  s21::unordered_map<std::string, std::string> m3(std::move(m1));
+  ASSERT_EQ(m2.size(), 100U);
+  ASSERT_EQ(m3.size(), 100U);
+  ASSERT_EQ(m1.empty(), true);
+  m1 = m2;
+  m2.clear();
+  ASSERT_EQ(m1.at("42"), std::string(30, 'y'));
+  ASSERT_EQ(m2.contains("42"), false);
+  m1.swap(m2);
+  ASSERT_EQ(m2.size(), 100U);
+}
+
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view s) const {
+    return std::hash<std::string_view>()(s);
+  }
+};
+
+TEST(unordered_map_access, transparent_00) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> m1{
+      {"one", 1}, {"two", 2}};
+  std::string_view key = "two";
+  ASSERT_EQ(m1.contains(key), true);
+  ASSERT_EQ(m1.at(key), 2);
+  ASSERT_EQ(m1.find(std::string_view("three")) == m1.end(), true);
+}
+
+TEST(unordered_map_main, pmr_00) {
+  using alloc = std::pmr::polymorphic_allocator<std::pair<int, std::string>>;
+  using pmr_map = s21::unordered_map<int, std::string, std::hash<int>,
+                                     std::equal_to<int>, alloc>;
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  pmr_map m1(0, std::hash<int>(), std::equal_to<int>(), alloc(&first));
+  pmr_map m2(0, std::hash<int>(), std::equal_to<int>(), alloc(&first));
+  pmr_map m3(0, std::hash<int>(), std::equal_to<int>(), alloc(&second));
+  for (int i = 0; i < 100; ++i) m1.insert(i, std::to_string(i));
+  ASSERT_EQ(m1.get_allocator().resource(), &first);
+  m1.swap(m2);
+  ASSERT_EQ(m2.size(), 100U);
+  m3 = std::move(m2);
+  ASSERT_EQ(m3.get_allocator().resource(), &second);
+  ASSERT_EQ(m3.size(), 100U);
+  ASSERT_EQ(m3.at(42), "42");
+  ASSERT_EQ(m2.empty(), true);
+  m1 = std::move(m3);
+  ASSERT_EQ(m1.at(7), "7");
+}
+
+// Counts the mapped values built by default construction and by moves.
+struct CountedValue {
+  static int constructions;
+  static int moves;
+  CountedValue() { ++constructions; }
+  CountedValue(CountedValue&& other) noexcept : value(other.value) {
+    ++moves;
+  }
+  int value = 0;
+};
+
+int CountedValue::constructions = 0;
+int CountedValue::moves = 0;
+
+TEST(unordered_map_access, subscript_00) {
+  s21::unordered_map<std::string, CountedValue> m1;
+  m1.reserve(64);
+  for (int i = 0; i < 64; ++i) m1[std::to_string(i)].value = i;
+  ASSERT_EQ(CountedValue::constructions, 64);
+  ASSERT_EQ(CountedValue::moves, 0);
+  for (int i = 0; i < 64; ++i) ASSERT_EQ(m1[std::to_string(i)].value, i);
+  ASSERT_EQ(CountedValue::constructions, 64);
+  ASSERT_EQ(m1.size(), 64U);
+}
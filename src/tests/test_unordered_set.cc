@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <unordered_set>
+
+#include "../s21_containersplus.h"
+
+TEST(unordered_set_capacity, empty_00) {
+  s21::unordered_set<int> s1;
+  ASSERT_EQ(s1.empty(), true);
+  ASSERT_EQ(s1.size(), 0U);
+  ASSERT_EQ(s1.count(0), 0U);
+}
+
+TEST(unordered_set_mod, insert_00) {
+  s21::unordered_set<int> s1{5, 1, 5, 3};
+  ASSERT_EQ(s1.size(), 3U);
+  auto result = s1.insert(3);
+  ASSERT_EQ(result.second, false);
+  ASSERT_EQ(*result.first, 3);
+  result = s1.insert(4);
+  ASSERT_EQ(result.second, true);
+  ASSERT_EQ(*result.first, 4);
+}
+
+TEST(unordered_set_mod, insert_01) {
+  s21::unordered_set<long long> s1;
+  std::unordered_set<long long> s2;
+  for (long long i = 0; i < 20000; ++i) {
+    long long key = (i * 2654435761LL) % 100003;
+    s1.insert(key);
+    s2.insert(key);
+  }
+  ASSERT_EQ(s1.size(), s2.size());
+  for (long long key : s2) ASSERT_EQ(s1.contains(key), true);
+  std::size_t visited = 0;
+  for (long long key : s1) visited += s2.count(key);
+  ASSERT_EQ(visited, s2.size());
+}
+
+TEST(unordered_set_mod, erase_00) {
+  s21::unordered_set<std::string> s1{"a", "b", "c"};
+  s1.erase(s1.find("b"));
+  ASSERT_EQ(s1.contains("b"), false);
+  ASSERT_EQ(s1.erase("a"), 1U);
+  ASSERT_EQ(s1.erase("a"), 0U);
+  ASSERT_EQ(s1.size(), 1U);
+  s1.clear();
+  ASSERT_EQ(s1.empty(), true);
+  s1.insert("d");
+  ASSERT_EQ(s1.contains("d"), true);
+}
+
+TEST(unordered_set_mod, merge_00) {
+  s21::unordered_set<int> s1{1, 2};
+  s21::unordered_set<int> s2{2, 3, 4};
+  s1.merge(s2);
+  ASSERT_EQ(s1.size(), 4U);
+  ASSERT_EQ(s2.size(), 1U);
+  ASSERT_EQ(s2.contains(2), true);
+}
+
+TEST(unordered_set_mod, insert_many_00) {
+  s21::unordered_set<int> s1;
+  auto result = s1.insert_many(1, 2, 2, 3);
+  ASSERT_EQ(result.size(), 4U);
+  ASSERT_EQ(result[2].second, false);
+  ASSERT_EQ(s1.size(), 3U);
+  ASSERT_EQ(*result[0].first, 1);
+}
+
+TEST(unordered_set_mod, pmr_00) {
+  using alloc = std::pmr::polymorphic_allocator<int>;
+  using pmr_set =
+      s21::unordered_set<int, std::hash<int>, std::equal_to<int>, alloc>;
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  pmr_set s1(0, std::hash<int>(), std::equal_to<int>(), alloc(&first));
+  pmr_set s2(0, std::hash<int>(), std::equal_to<int>(), alloc(&second));
+  for (int i = 0; i < 100; ++i) s1.insert(i);
+  pmr_set s3(s1);
+  ASSERT_EQ(s3.get_allocator().resource(), std::pmr::get_default_resource());
+  s2 = std::move(s1);
+  ASSERT_EQ(s2.get_allocator().resource(), &second);
+  ASSERT_EQ(s2.size(), 100U);
+  ASSERT_EQ(s2.contains(99), true);
+  ASSERT_EQ(s1.empty(), true);
+}
+
+// Keys that differ only in their high bits must not share a probe start:
+// the bits H1 is taken from have to depend on them too.
+TEST(unordered_set_hash, high_bits_00) {
+  std::unordered_set<std::uint64_t> starts;
+  for (std::uint64_t i = 0; i < 4096; ++i) {
+    starts.insert((s21::hashMix(i << 32) >> 7) & 4095);
+  }
+  ASSERT_GT(starts.size(), 2048U);
+  s21::unordered_set<unsigned long long> s1;
+  for (unsigned long long i = 0; i < 20000; ++i) s1.insert(i << 40);
+  ASSERT_EQ(s1.size(), 20000U);
+  for (unsigned long long i = 0; i < 20000; ++i) {
+    ASSERT_EQ(s1.contains(i << 40), true);
+  }
+  ASSERT_EQ(s1.contains(1), false);
+}
@@ -0,0 +1,44 @@
+#ifndef SRC_TESTS_TEST_UTILS_H_
+#define SRC_TESTS_TEST_UTILS_H_
+
+#include <cstddef>
+#include <memory_resource>
+
+// Helpers shared by the test files.
+namespace s21_test {
+// Forwards to new/delete and counts the allocations that pass through.
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t allocations = 0;
+
+ protected:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// Installs a default memory resource for its lifetime, so a failing
+// ASSERT cannot leave later tests on a destroyed resource.
+class DefaultResourceGuard {
+ public:
+  explicit DefaultResourceGuard(std::pmr::memory_resource *resource)
+      : previous_(std::pmr::set_default_resource(resource)) {}
+  ~DefaultResourceGuard() { std::pmr::set_default_resource(previous_); }
+
+  DefaultResourceGuard(const DefaultResourceGuard &) = delete;
+  DefaultResourceGuard &operator=(const DefaultResourceGuard &) = delete;
+
+ private:
+  std::pmr::memory_resource *previous_;
+};
+}  // namespace s21_test
+
+#endif  // SRC_TESTS_TEST_UTILS_H_
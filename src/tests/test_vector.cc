@@ -1,4 +1,10 @@
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../s21_vector.h"
@@ -142,7 +148,10 @@ TEST(TestVector, Assignment_3) {
 
 TEST(TestVector, At_1) {
   s21::vector<int> vector1{1, 2, 3, 4, 5, 6};
-  EXPECT_THROW(vector1[6], std::out_of_range);
+  EXPECT_THROW(vector1.at(6), std::out_of_range);
+  const s21::vector<int> vector2{1, 2, 3};
+  EXPECT_THROW(vector2.at(3), std::out_of_range);
+  EXPECT_EQ(vector2.at(2), 3);
 }
 
 TEST(TestVector, At_2) {
@@ -151,8 +160,9 @@ TEST(TestVector, At_2) {
 }
 
 TEST(TestVector, Front_1) {
-  s21::vector<int> vector1;
-  EXPECT_THROW(vector1.front(), std::logic_error);
+  s21::vector<int> vector1{1, 2, 3};
+  vector1.front() = 7;
+  EXPECT_EQ(vector1[0], 7);
 }
 
 TEST(TestVector, Front_2) {
@@ -162,8 +172,9 @@ TEST(TestVector, Front_2) {
 }
 
 TEST(TestVector, Back_1) {
-  s21::vector<int> vector1;
-  EXPECT_THROW(vector1.back(), std::logic_error);
+  s21::vector<int> vector1{1, 2, 3};
+  vector1.back() = 7;
+  EXPECT_EQ(vector1[2], 7);
 }
 
 TEST(TestVector, Back_2) {
@@ -392,3 +403,317 @@ TEST(TestVector, Insert_many_Back_2) {
   vector1.insert_many_back();
   EXPECT_TRUE(compare_vectors(vector1, vector2));
 }
+
+namespace {
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  Tracked() = default;
+  explicit Tracked(std::string text) : value(std::move(text)) {}
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) noexcept : value(std::move(other.value)) {
+    ++moves;
+  }
+  Tracked &operator=(const Tracked &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  Tracked &operator=(Tracked &&other) noexcept {
+    value = std::move(other.value);
+    ++moves;
+    return *this;
+  }
+
+  std::string value;
+};
+}  // namespace
+
+TEST(TestVector, Move_1) {
+  s21::vector<Tracked> vector1;
+  Tracked::copies = 0;
+  for (int i = 0; i < 100; ++i) {
+    vector1.push_back(Tracked(std::to_string(i)));
+    vector1.emplace_back(std::to_string(i));
+  }
+  vector1.emplace(vector1.begin(), "front");
+  vector1.insert(vector1.begin() + 1, Tracked("second"));
+  vector1.erase(vector1.begin() + 2);
+  vector1.reserve(1000);
+  vector1.shrink_to_fit();
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(vector1.size(), (size_t)201);
+  EXPECT_EQ(vector1[0].value, "front");
+  EXPECT_EQ(vector1[1].value, "second");
+  EXPECT_EQ(vector1[2].value, "0");
+  EXPECT_EQ(vector1[200].value, "99");
+}
+
+TEST(TestVector, Move_2) {
+  s21::vector<std::unique_ptr<int>> vector1;
+  vector1.push_back(std::make_unique<int>(1));
+  vector1.emplace_back(new int(3));
+  vector1.emplace(vector1.begin() + 1, std::make_unique<int>(2));
+  vector1.insert_many_back(std::make_unique<int>(4), std::make_unique<int>(5));
+  ASSERT_EQ(vector1.size(), (size_t)5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(*vector1[i], i + 1);
+  vector1.emplace_back(std::move(vector1[0]));
+  EXPECT_EQ(vector1[0], nullptr);
+  EXPECT_EQ(*vector1[5], 1);
+}
+
+TEST(TestVector, PushBack_2) {
+  s21::vector<std::string> vector1;
+  std::vector<std::string> vector2;
+  for (int i = 0; i < 32; ++i) {
+    vector1.push_back(std::to_string(i));
+    vector2.push_back(std::to_string(i));
+  }
+  vector1.push_back(vector1[0]);
+  vector2.push_back(vector2[0]);
+  EXPECT_TRUE(compare_vectors(vector1, vector2));
+}
+
+namespace {
+struct Live {
+  static inline int alive = 0;
+  static inline int constructed = 0;
+
+  explicit Live(int v) : value(v) { ++alive, ++constructed; }
+  Live(const Live &other) : value(other.value) { ++alive, ++constructed; }
+  ~Live() { --alive; }
+  Live &operator=(const Live &) = default;
+
+  int value;
+};
+}  // namespace
+
+TEST(TestVector, Storage_1) {
+  Live::alive = Live::constructed = 0;
+  {
+    s21::vector<Live> vector1;
+    vector1.reserve(1000);
+    EXPECT_EQ(Live::constructed, 0);
+    for (int i = 0; i < 10; ++i) vector1.emplace_back(i);
+    EXPECT_EQ(Live::alive, 10);
+    vector1.pop_back();
+    vector1.erase(vector1.begin());
+    EXPECT_EQ(Live::alive, 8);
+    EXPECT_EQ(vector1[0].value, 1);
+    vector1.resize(20, Live(7));
+    EXPECT_EQ(Live::alive, 20);
+    EXPECT_EQ(vector1[19].value, 7);
+    vector1.resize(5, vector1[0]);
+    EXPECT_EQ(Live::alive, 5);
+    vector1.clear();
+    EXPECT_EQ(Live::alive, 0);
+    EXPECT_EQ(vector1.capacity(), (size_t)1000);
+    s21::vector<Live> vector2(3, Live(4));
+    vector1 = vector2;
+    EXPECT_EQ(Live::alive, 6);
+  }
+  EXPECT_EQ(Live::alive, 0);
+}
+
+TEST(TestVector, Resize_1) {
+  s21::vector<std::string> vector1{"a", "b"};
+  std::vector<std::string> vector2{"a", "b"};
+  vector1.resize(5);
+  vector2.resize(5);
+  EXPECT_TRUE(compare_vectors(vector1, vector2));
+  vector1.resize(12, vector1[0]);
+  vector2.resize(12, vector2[0]);
+  EXPECT_TRUE(compare_vectors(vector1, vector2));
+  vector1.resize(1);
+  vector2.resize(1);
+  EXPECT_TRUE(compare_vectors(vector1, vector2));
+
+  s21::vector<int> vector3;
+  vector3.resize_for_overwrite(100);
+  for (int i = 0; i < 100; ++i) vector3[i] = i;
+  EXPECT_EQ(vector3.size(), (size_t)100);
+  EXPECT_EQ(vector3[99], 99);
+}
+
+namespace {
+struct Packet {
+  int id;
+  char payload[60];
+};
+}  // namespace
+
+template <>
+struct s21::vector_growth<Packet> {
+  static constexpr size_t kNumerator = 3;
+  static constexpr size_t kDenominator = 2;
+  static constexpr size_t kMinCapacity = 4;
+};
+
+TEST(TestVector, Growth_1) {
+  s21::vector<int> vector1;
+  vector1.push_back(1);
+  EXPECT_EQ(vector1.capacity(), s21::vector_growth<int>::kMinCapacity);
+  for (int i = 2; i <= 100; ++i) vector1.push_back(vector1[0] + i - 1);
+  EXPECT_EQ(vector1.capacity(), (size_t)128);
+  vector1.insert(vector1.begin() + 50, -1);
+  EXPECT_EQ(vector1[50], -1);
+  EXPECT_EQ(vector1[51], 51);
+  EXPECT_EQ(vector1[100], 100);
+
+  s21::vector<Packet> vector2;
+  std::vector<size_t> capacities;
+  for (int i = 0; i < 20; ++i) {
+    vector2.push_back(Packet{i, {}});
+    if (capacities.empty() || capacities.back() != vector2.capacity()) {
+      capacities.push_back(vector2.capacity());
+    }
+  }
+  EXPECT_EQ(capacities, (std::vector<size_t>{4, 6, 9, 13, 19, 28}));
+  EXPECT_EQ(vector2[19].id, 19);
+
+  s21::vector<Packet> vector3(4);
+  vector3.resize(5);
+  EXPECT_EQ(vector3.capacity(), (size_t)6);
+  vector3.resize(20);
+  EXPECT_EQ(vector3.capacity(), (size_t)20);
+}
+
+TEST(TestVector, ReserveExact_1) {
+  s21::vector<std::string> vector1{"a", "b", "c"};
+  vector1.reserve_exact(10);
+  EXPECT_EQ(vector1.capacity(), (size_t)10);
+  vector1.reserve_exact(5);
+  EXPECT_EQ(vector1.capacity(), (size_t)5);
+  vector1.reserve_exact(0);
+  EXPECT_EQ(vector1.capacity(), (size_t)3);
+  EXPECT_EQ(vector1[2], "c");
+  s21::vector<int> vector2{1, 2};
+  vector2.clear();
+  vector2.reserve_exact(0);
+  EXPECT_EQ(vector2.capacity(), (size_t)0);
+  vector2.push_back(3);
+  EXPECT_EQ(vector2[0], 3);
+}
+
+TEST(TestVector, InsertRange_1) {
+  s21::vector<int> vector1 = {1, 2, 3, 4, 5, 6};
+  std::vector<int> vector2 = {1, 2, 3, 4, 5, 6};
+  std::vector<int> items = {10, 11, 12};
+  auto it = vector1.insert(vector1.begin() + 2, items.begin(), items.end());
+  vector2.insert(vector2.begin() + 2, items.begin(), items.end());
+  EXPECT_EQ(*it, 10);
+  EXPECT_TRUE(compare_vectors(vector1, vector2));
+  vector1.insert(vector1.begin() + 1, 3, -1);
+  vector2.insert(vector2.begin() + 1, 3, -1);
+  EXPECT_TRUE(compare_vectors(vector1, vector2));
+  vector1.insert(vector1.end(), 2, vector1[0]);
+  vector2.insert(vector2.end(), 2, vector2[0]);
+  EXPECT_TRUE(compare_vectors(vector1, vector2));
+}
+
+TEST(TestVector, InsertRange_2) {
+  s21::vector<std::string> vector1 = {"a", "b", "c"};
+  std::vector<std::string> vector2 = {"a", "b", "c"};
+  std::vector<std::string> items = {"x", "y"};
+  vector1.reserve(10);
+  vector1.insert(vector1.begin() + 1, items.begin(), items.end());
+  vector1.insert(vector1.begin(), items.begin(), items.end());
+  vector1.insert(vector1.end() - 1, 8, "z");
+  vector2.insert(vector2.begin() + 1, items.begin(), items.end());
+  vector2.insert(vector2.begin(), items.begin(), items.end());
+  vector2.insert(vector2.end() - 1, 8, "z");
+  ASSERT_EQ(vector1.size(), vector2.size());
+  for (size_t i = 0; i < vector2.size(); i++) EXPECT_EQ(vector1[i], vector2[i]);
+}
+
+TEST(TestVector, InsertRange_3) {
+  s21::vector<int> vector1 = {1, 2, 3};
+  std::istringstream input("7 8 9");
+  vector1.insert(vector1.begin() + 1, std::istream_iterator<int>(input),
+                 std::istream_iterator<int>());
+  vector1.append_range(std::vector<int>{4, 5});
+  int tail[] = {6};
+  vector1.append_range(tail);
+  std::vector<int> expected = {1, 7, 8, 9, 2, 3, 4, 5, 6};
+  EXPECT_TRUE(std::equal(vector1.begin(), vector1.end(), expected.begin(),
+                         expected.end()));
+}
+
+TEST(TestVector, EraseRange_1) {
+  s21::vector<std::string> vector1 = {"a", "b", "c", "d", "e", "f"};
+  auto it = vector1.erase(vector1.begin() + 1, vector1.begin() + 4);
+  EXPECT_EQ(*it, "e");
+  EXPECT_EQ(vector1.size(), (size_t)3);
+  EXPECT_EQ(vector1[0], "a");
+  EXPECT_EQ(vector1[2], "f");
+  it = vector1.erase(vector1.begin(), vector1.begin());
+  EXPECT_EQ(it, vector1.begin());
+  vector1.erase(vector1.begin(), vector1.end());
+  EXPECT_TRUE(vector1.empty());
+  EXPECT_THROW(vector1.erase(vector1.end()), std::length_error);
+}
+
+TEST(TestVector, Insert_many_5) {
+  s21::vector<std::string> vector1 = {"a", "b"};
+  vector1.shrink_to_fit();
+  auto it = vector1.insert_many(vector1.begin() + 1, vector1[1], vector1[0]);
+  EXPECT_EQ(*it, "a");
+  EXPECT_EQ(vector1.size(), (size_t)4);
+  EXPECT_EQ(vector1[0], "a");
+  EXPECT_EQ(vector1[1], "b");
+  EXPECT_EQ(vector1[2], "a");
+  EXPECT_EQ(vector1[3], "b");
+}
+
+namespace {
+template <typename V, typename Arg, typename = void>
+struct CanInsertMany : std::false_type {};
+
+template <typename V, typename Arg>
+struct CanInsertMany<
+    V, Arg,
+    std::void_t<decltype(std::declval<V &>().insert_many(
+        std::declval<const V &>().begin(), std::declval<Arg>()))>>
+    : std::true_type {};
+
+struct Explicit {
+  explicit Explicit(int v) : value(v) {}
+  int value;
+};
+}  // namespace
+
+TEST(TestVector, Insert_many_6) {
+  static_assert(!CanInsertMany<s21::vector<long>, long *>::value);
+  static_assert(CanInsertMany<s21::vector<long>, int>::value);
+  static_assert(!CanInsertMany<s21::vector<std::string>, int>::value);
+  s21::vector<Explicit> vector1;
+  vector1.insert_many_back(1, 2);
+  auto it = vector1.insert_many(vector1.begin(), 0);
+  EXPECT_EQ(it, vector1.begin());
+  EXPECT_EQ(vector1.size(), (size_t)3);
+  EXPECT_EQ(vector1[0].value, 0);
+  EXPECT_EQ(vector1[2].value, 2);
+}
+
+TEST(TestVector, Search_1) {
+  s21::vector<uint8_t> vector1(100, 3);
+  vector1[70] = 200;
+  vector1[90] = 1;
+  EXPECT_EQ(vector1.find(200) - vector1.begin(), 70);
+  EXPECT_EQ(vector1.find(7), vector1.end());
+  EXPECT_FALSE(vector1.contains(7));
+  EXPECT_EQ(vector1.min(), 1);
+  EXPECT_EQ(vector1.max(), 200);
+  EXPECT_EQ(vector1.sum(), (uint64_t)(98 * 3 + 200 + 1));
+  s21::vector<uint8_t> vector2(vector1);
+  EXPECT_TRUE(vector1 == vector2);
+  vector2.pop_back();
+  EXPECT_TRUE(vector1 != vector2);
+  s21::vector<std::string> vector3 = {"b", "a", "c"};
+  EXPECT_EQ(vector3.min(), "a");
+  EXPECT_TRUE(vector3.contains("c"));
+  vector3.clear();
+  EXPECT_THROW(vector3.max(), std::out_of_range);
+  EXPECT_THROW(vector3.min(), std::out_of_range);
+}